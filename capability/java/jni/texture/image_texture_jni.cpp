@@ -20,6 +20,7 @@
 
 #include "adapter/android/entrance/java/jni/jni_environment.h"
 #include "base/log/log.h"
+#include "base/utils/time_util.h"
 #include "base/utils/utils.h"
 
 namespace OHOS::Ace::Platform {
@@ -38,11 +39,7 @@ ImageTextureJni::ImageTextureJni()
 ImageTextureJni::~ImageTextureJni()
 {
     std::lock_guard<std::mutex> lock(imageReaderMutex_);
-    if (imageReader_ != nullptr) {
-        AImageReader_setImageListener(imageReader_, nullptr);
-        AImageReader_delete(imageReader_);
-        imageReader_ = nullptr;
-    }
+    ReleaseImageReader();
 
     if (oldNativeWindow_ != nullptr) {
         ANativeWindow_release(oldNativeWindow_);
@@ -55,13 +52,21 @@ ImageTextureJni::~ImageTextureJni()
     }
 }
 
-int32_t ImageTextureJni::Create(int32_t width, int32_t height, int32_t format, int64_t usageFlags, int32_t maxImages)
+void ImageTextureJni::ReleaseImageReader()
 {
-    if (imageReader_ != nullptr) {
-        AImageReader_setImageListener(imageReader_, nullptr);
-        AImageReader_delete(imageReader_);
-        imageReader_ = nullptr;
+    if (imageReader_ == nullptr) {
+        return;
     }
+    AImageReader_setImageListener(imageReader_, nullptr);
+    // Pending images belong to the reader and must be returned before it is deleted.
+    DropPendingFrame();
+    AImageReader_delete(imageReader_);
+    imageReader_ = nullptr;
+}
+
+int32_t ImageTextureJni::Create(int32_t width, int32_t height, int32_t format, int64_t usageFlags, int32_t maxImages)
+{
+    ReleaseImageReader();
     if (oldNativeWindow_ != nullptr) {
         ANativeWindow_release(oldNativeWindow_);
         oldNativeWindow_ = nullptr;
@@ -103,14 +108,69 @@ void ImageTextureJni::OnImageAvailable(void* context, AImageReader* reader)
 {
     ImageTextureJni* texture = static_cast<ImageTextureJni*>(context);
     if (texture != nullptr) {
-        texture->NotifyImageAvailable();
+        texture->PublishLatestFrame(reader);
+    }
+}
+
+void ImageTextureJni::PublishLatestFrame(AImageReader* reader)
+{
+    CHECK_NULL_VOID(reader);
+    AImage* image = nullptr;
+    media_status_t status = AImageReader_acquireLatestImage(reader, &image);
+    if (status != AMEDIA_OK || image == nullptr) {
+        return;
+    }
+    AHardwareBuffer* hardwareBuffer = nullptr;
+    status = AImage_getHardwareBuffer(image, &hardwareBuffer);
+    if (status != AMEDIA_OK || hardwareBuffer == nullptr) {
+        LOGE("AImage_getHardwareBuffer failed, status=%{public}d", status);
+        AImage_delete(image);
+        return;
+    }
+    AHardwareBuffer_Desc desc;
+    AHardwareBuffer_describe(hardwareBuffer, &desc);
+    if (desc.width <= 0 || desc.height <= 0) {
+        LOGE("Invalid hardware buffer dimensions: width=%{public}d, height=%{public}d", desc.width, desc.height);
+        AImage_delete(image);
+        return;
+    }
+
+    auto* frame = new (std::nothrow) AcquiredFrame();
+    if (frame == nullptr) {
+        AImage_delete(image);
+        return;
+    }
+    frame->image = image;
+    frame->buffer = hardwareBuffer;
+    frame->bufferWidth = desc.width;
+    frame->bufferHeight = desc.height;
+    frame->availableTime = GetSysTimestamp();
+    availableFrames_.fetch_add(1, std::memory_order_relaxed);
+
+    AcquiredFrame* staleFrame = latestFrame_.exchange(frame, std::memory_order_acq_rel);
+    if (staleFrame != nullptr) {
+        droppedFrames_.fetch_add(1, std::memory_order_relaxed);
+        delete staleFrame;
+    }
+    // Notified on every publish, a wakeup lost for the replaced frame would otherwise leave this one unseen.
+    // The listeners coalesce the notifications into the next render pass.
+    NotifyImageAvailable();
+}
+
+void ImageTextureJni::DropPendingFrame()
+{
+    AcquiredFrame* pendingFrame = latestFrame_.exchange(nullptr, std::memory_order_acq_rel);
+    if (pendingFrame != nullptr) {
+        droppedFrames_.fetch_add(1, std::memory_order_relaxed);
+        delete pendingFrame;
     }
 }
 
 void ImageTextureJni::NotifyImageAvailable()
 {
-    std::lock_guard<std::mutex> lock(listenerMutex_);
-    for (auto& [id, listener] : imageAvailableListeners_) {
+    auto listeners = std::atomic_load_explicit(&imageAvailableListeners_, std::memory_order_acquire);
+    CHECK_NULL_VOID(listeners);
+    for (const auto& [id, listener] : *listeners) {
         if (listener != nullptr) {
             listener->OnImageAvailable(textureId_);
         }
@@ -122,17 +182,23 @@ ImageTextureJni::ImageListenerId ImageTextureJni::SetImageAvailableListener(
 {
     std::lock_guard<std::mutex> lock(listenerMutex_);
     uint32_t listenerId = ++currentListenerId_;
-    imageAvailableListeners_[listenerId] = listenerContent;
+    auto listeners = std::make_shared<ListenerMap>(*imageAvailableListeners_);
+    (*listeners)[listenerId] = listenerContent;
+    std::atomic_store_explicit(&imageAvailableListeners_, std::shared_ptr<const ListenerMap>(std::move(listeners)),
+        std::memory_order_release);
     return listenerId;
 }
 
 void ImageTextureJni::RemoveImageAvailableListener(const ImageListenerId& listener)
 {
     std::lock_guard<std::mutex> lock(listenerMutex_);
-    auto it = imageAvailableListeners_.find(listener);
-    if (it != imageAvailableListeners_.end()) {
-        imageAvailableListeners_.erase(it);
+    if (imageAvailableListeners_->find(listener) == imageAvailableListeners_->end()) {
+        return;
     }
+    auto listeners = std::make_shared<ListenerMap>(*imageAvailableListeners_);
+    listeners->erase(listener);
+    std::atomic_store_explicit(&imageAvailableListeners_, std::shared_ptr<const ListenerMap>(std::move(listeners)),
+        std::memory_order_release);
 }
 
 bool ImageTextureJni::IsValidHardwareBuffer(const AHardwareBuffer* buffer) const
@@ -258,35 +324,50 @@ bool ImageTextureJni::GetUpdateState()
 
 std::shared_ptr<AcquiredFrame> ImageTextureJni::AcquireLatestHardwareBuffer()
 {
-    std::lock_guard<std::mutex> lock(imageReaderMutex_);
-    CHECK_NULL_RETURN(imageReader_, nullptr);
+    AcquiredFrame* frame = latestFrame_.exchange(nullptr, std::memory_order_acq_rel);
+    CHECK_NULL_RETURN(frame, nullptr);
+
+    int64_t latency = GetSysTimestamp() - frame->availableTime;
+    consumedFrames_.fetch_add(1, std::memory_order_relaxed);
+    lastLatency_.store(latency, std::memory_order_relaxed);
+    totalLatency_.fetch_add(latency, std::memory_order_relaxed);
+    int64_t maxLatency = maxLatency_.load(std::memory_order_relaxed);
+    while (latency > maxLatency &&
+           !maxLatency_.compare_exchange_weak(maxLatency, latency, std::memory_order_relaxed)) {}
+    return std::shared_ptr<AcquiredFrame>(frame);
+}
 
-    AImage* image = nullptr;
-    media_status_t status = AImageReader_acquireLatestImage(imageReader_, &image);
-    if (status != AMEDIA_OK || image == nullptr) {
-        return nullptr;
-    }
-    AHardwareBuffer* lastHardwareBuffer = nullptr;
-    status = AImage_getHardwareBuffer(image, &lastHardwareBuffer);
-    if (status != AMEDIA_OK) {
-        LOGE("AImage_getHardwareBuffer failed, status=%{public}d", status);
-        AImage_delete(image);
-        return nullptr;
-    }
-    AHardwareBuffer_Desc desc;
-    AHardwareBuffer_describe(lastHardwareBuffer, &desc);
-    if (desc.width <= 0 || desc.height <= 0) {
-        LOGE("Invalid hardware buffer dimensions: width=%{public}d, height=%{public}d", desc.width, desc.height);
-        AImage_delete(image);
-        return nullptr;
-    }
+ImageTextureStats ImageTextureJni::GetStats() const
+{
+    ImageTextureStats stats;
+    stats.availableFrames = availableFrames_.load(std::memory_order_relaxed);
+    stats.droppedFrames = droppedFrames_.load(std::memory_order_relaxed);
+    stats.consumedFrames = consumedFrames_.load(std::memory_order_relaxed);
+    stats.lastLatency = lastLatency_.load(std::memory_order_relaxed);
+    stats.maxLatency = maxLatency_.load(std::memory_order_relaxed);
+    stats.totalLatency = totalLatency_.load(std::memory_order_relaxed);
+    return stats;
+}
 
-    auto frame = std::make_shared<AcquiredFrame>();
-    frame->image = image;
-    frame->buffer = lastHardwareBuffer;
-    frame->bufferWidth = desc.width;
-    frame->bufferHeight = desc.height;
-    return frame;
+std::string ImageTextureJni::DumpAllStats()
+{
+    constexpr int64_t NANOS_PER_MICRO = 1000;
+    std::lock_guard<std::mutex> lock(g_textureMapMutex);
+    std::stringstream desc;
+    desc << "textures: " << g_textureMap.size();
+    for (const auto& [id, texture] : g_textureMap) {
+        if (texture == nullptr) {
+            continue;
+        }
+        auto stats = texture->GetStats();
+        int64_t avgLatency = stats.consumedFrames > 0 ?
+            stats.totalLatency / static_cast<int64_t>(stats.consumedFrames) : 0;
+        desc << "\ntexture " << id << " available: " << stats.availableFrames << ", dropped: " << stats.droppedFrames
+             << ", consumed: " << stats.consumedFrames << ", latency last/avg/max(us): "
+             << stats.lastLatency / NANOS_PER_MICRO << "/" << avgLatency / NANOS_PER_MICRO << "/"
+             << stats.maxLatency / NANOS_PER_MICRO;
+    }
+    return desc.str();
 }
 
 void ImageTextureJni::JniDeleteImageTexture(JNIEnv* env, jobject myObject, jlong imageTextureId)
@@ -18,6 +18,7 @@
 
 #include <android/hardware_buffer_jni.h>
 #include <android/native_window.h>
+#include <atomic>
 #include <cstddef>
 #include <cstdint>
 #include <functional>
@@ -26,6 +27,7 @@
 #include <memory>
 #include <mutex>
 #include <queue>
+#include <string>
 #include <vector>
 
 namespace OHOS::Ace::Platform {
@@ -34,6 +36,8 @@ struct AcquiredFrame {
     AHardwareBuffer* buffer = nullptr;
     uint32_t bufferWidth = 0;
     uint32_t bufferHeight = 0;
+    // Monotonic time in nanoseconds at which the frame was published to the latest-frame slot.
+    int64_t availableTime = 0;
 
     ~AcquiredFrame()
     {
@@ -47,6 +51,15 @@ struct AcquiredFrame {
     }
 };
 
+struct ImageTextureStats {
+    uint64_t availableFrames = 0;
+    uint64_t droppedFrames = 0;
+    uint64_t consumedFrames = 0;
+    int64_t lastLatency = 0;
+    int64_t maxLatency = 0;
+    int64_t totalLatency = 0;
+};
+
 class ImageTextureJni {
 public:
     using ImageTextureOnAvailableCallback = std::function<void(ImageTextureJni* imageTexture)>;
@@ -98,6 +111,9 @@ public:
     void SetUpdateState(bool state);
     bool GetUpdateState();
     std::shared_ptr<AcquiredFrame> AcquireLatestHardwareBuffer();
+    ImageTextureStats GetStats() const;
+    // One line of frame and publish-to-consume latency counters per live texture, for the view dump.
+    static std::string DumpAllStats();
     static bool Register(const std::shared_ptr<JNIEnv>& env);
     static jlong JniCreateImageTexture(JNIEnv* env, jobject myObject);
     static jobject JniGetImageSurface(JNIEnv* env, jobject myObject, jlong imageTextureId,
@@ -125,7 +141,12 @@ private:
         return imageReader_;
     }
 
+    using ListenerMap = std::map<ImageListenerId, std::shared_ptr<ListenerContent>>;
+
     void NotifyImageAvailable();
+    void PublishLatestFrame(AImageReader* reader);
+    void DropPendingFrame();
+    void ReleaseImageReader();
     bool IsValidHardwareBuffer(const AHardwareBuffer* buffer) const;
     static void OnImageAvailable(void* context, AImageReader* reader);
 
@@ -143,7 +164,17 @@ private:
     std::mutex imageReaderMutex_;
     std::mutex listenerMutex_;
     std::mutex stateMutex_;
-    std::map<int32_t, std::shared_ptr<ListenerContent>> imageAvailableListeners_;
+    // Copy-on-write snapshot, so the image reader callback never blocks on listener registration.
+    std::shared_ptr<const ListenerMap> imageAvailableListeners_ = std::make_shared<const ListenerMap>();
+    // Single-slot mailbox holding the newest frame not yet consumed by the render side.
+    std::atomic<AcquiredFrame*> latestFrame_ { nullptr };
+    // Statistics only, never used for synchronization.
+    std::atomic<uint64_t> availableFrames_ { 0 };
+    std::atomic<uint64_t> droppedFrames_ { 0 };
+    std::atomic<uint64_t> consumedFrames_ { 0 };
+    std::atomic<int64_t> lastLatency_ { 0 };
+    std::atomic<int64_t> maxLatency_ { 0 };
+    std::atomic<int64_t> totalLatency_ { 0 };
     ImageTextureId textureId_ = 0;
     jlong instanceId_;
     jlong id_;
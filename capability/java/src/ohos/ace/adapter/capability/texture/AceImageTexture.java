@@ -26,9 +26,11 @@ import android.view.Surface;
 import ohos.ace.adapter.AceSurfaceHolder;
 import ohos.ace.adapter.AceTextureHolder;
 import ohos.ace.adapter.ALog;
+import ohos.ace.adapter.AppModeConfig;
 
 import java.util.HashSet;
 import java.util.Set;
+import java.util.concurrent.atomic.AtomicBoolean;
 
 /**
  * This class handles the lifecycle of a surface texture.
@@ -36,6 +38,10 @@ import java.util.Set;
  * @since 26
  */
 public class AceImageTexture implements IAceSurfaceTexture {
+    static {
+        AppModeConfig.registerCapability(AppModeConfig.CAPABILITY_IMAGE_TEXTURE);
+    }
+
     private static final String LOG_TAG = "AceImageTexture";
     private static final int MAX_IMAGES = 3;
 
@@ -62,6 +68,7 @@ public class AceImageTexture implements IAceSurfaceTexture {
     private IAceSurfaceTexture.OnFrameAvailableListener onFrameAvailableListener = null;
     private OnImageAvailableListener listener = null;
     private Handler mainHandler;
+    private final AtomicBoolean framePosted = new AtomicBoolean(false);
     private boolean hasRegistered = false;
     private volatile int rotationDegrees = 0;
 
@@ -116,9 +123,15 @@ public class AceImageTexture implements IAceSurfaceTexture {
     }
 
     private void notifyFrameAvailable() {
+        // Native notifies on every frame, frames arriving before the post runs are coalesced into it.
+        if (!framePosted.compareAndSet(false, true)) {
+            return;
+        }
         mainHandler.post(new Runnable() {
             @Override
             public void run() {
+                // Cleared first, so a frame published while the listener runs posts again.
+                framePosted.set(false);
                 if (onFrameAvailableListener != null) {
                     onFrameAvailableListener.onFrameAvailable(AceImageTexture.this);
                 }
@@ -20,6 +20,7 @@ import android.webkit.WebBackForwardList;
 import java.util.HashMap;
 import java.util.Map;
 import ohos.ace.adapter.ALog;
+import ohos.ace.adapter.AppModeConfig;
 import ohos.ace.adapter.IAceOnCallResourceMethod;
 import ohos.ace.adapter.IAceOnResourceEvent;
 
@@ -29,6 +30,10 @@ import ohos.ace.adapter.IAceOnResourceEvent;
  * @since 1
  */
 public abstract class AceWebBase {
+    static {
+        AppModeConfig.registerCapability(AppModeConfig.CAPABILITY_WEB);
+    }
+
     private static final String LOG_TAG = "AceWebBase";
 
     /** Should be the same with corresponding var
@@ -17,7 +17,11 @@
 #define FOUNDATION_ACE_ADAPTER_ANDROID_ENTRANCE_JAVA_JNI_APK_ASSET_PROVIDER_H
 
 #include <memory>
+#include <mutex>
 #include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
 
 #include "adapter/android/entrance/java/jni/pack_asset_provider.h"
 #include "base/resource/asset_manager.h"
@@ -40,6 +44,8 @@ public:
     {
         LOGD("SetAssetManager %{public}p", assetManager);
         assetManager_ = assetManager;
+        std::lock_guard<std::mutex> lock(listingMutex_);
+        listings_.clear();
     }
 
     std::unique_ptr<AssetMapping> GetAsMapping(const std::string& assetName) const override
@@ -95,20 +101,11 @@ public:
             fileName = assetName.substr(pos + 1);
         }
 
-        AAssetDir *dir = AAssetManager_openDir(assetManager_, dirPath.c_str());
-        if (dir == nullptr) {
-            LOGE("Fail to open asset dir: %{public}s", dirPath.c_str());
+        auto listing = GetDirListing(dirPath);
+        if (!listing || listing->names.count(fileName) == 0) {
             return "";
         }
-        const char *entry = nullptr;
-        while ((entry = AAssetDir_getNextFileName(dir)) != nullptr) {
-            if (fileName == entry) {
-                AAssetDir_close(dir);
-                return (isAddHapPath ? (appPath_ + "/" + basePath_) : basePath_) + "/";
-            }
-        }
-        AAssetDir_close(dir);
-        return "";
+        return (isAddHapPath ? (appPath_ + "/" + basePath_) : basePath_) + "/";
     }
 
     void GetAssetList(const std::string& path, std::vector<std::string>& assetList) override
@@ -130,25 +127,53 @@ public:
             }
         }
 
+        auto listing = GetDirListing(dirPath);
+        if (!listing) {
+            return;
+        }
+        for (const auto& entry : listing->entries) {
+            assetList.emplace_back("./" + entry);
+        }
+    }
+
+private:
+    struct DirListing {
+        std::vector<std::string> entries;
+        std::unordered_set<std::string> names;
+    };
+
+    // The apk does not change while the app runs, so each directory is listed once per provider.
+    std::shared_ptr<const DirListing> GetDirListing(const std::string& dirPath)
+    {
+        {
+            std::lock_guard<std::mutex> lock(listingMutex_);
+            auto iter = listings_.find(dirPath);
+            if (iter != listings_.end()) {
+                return iter->second;
+            }
+        }
         AAssetDir *dir = AAssetManager_openDir(assetManager_, dirPath.c_str());
         if (dir == nullptr) {
             LOGE("Fail to open asset dir: %{public}s", dirPath.c_str());
-            return;
+            return nullptr;
         }
+        auto listing = std::make_shared<DirListing>();
         const char *entry = nullptr;
         while ((entry = AAssetDir_getNextFileName(dir)) != nullptr) {
-            std::string file = "./";
-            file += entry;
-            assetList.emplace_back(file);
+            listing->entries.emplace_back(entry);
+            listing->names.emplace(entry);
         }
         AAssetDir_close(dir);
+        std::lock_guard<std::mutex> lock(listingMutex_);
+        return listings_.emplace(dirPath, std::move(listing)).first->second;
     }
 
-private:
     std::string basePath_;
     std::unique_ptr<PackAssetProvider> assetProvider_;
     std::string appPath_;
     AAssetManager *assetManager_ = nullptr;
+    std::mutex listingMutex_;
+    std::unordered_map<std::string, std::shared_ptr<const DirListing>> listings_;
 };
 
 } // namespace OHOS::Ace
@@ -0,0 +1,193 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "adapter/android/entrance/java/jni/input_latency_recorder.h"
+
+#include <cerrno>
+#include <cstring>
+#include <vector>
+
+#include "adapter/android/entrance/java/jni/pointer_event_pool.h"
+#include "base/log/log.h"
+#include "base/utils/time_util.h"
+
+namespace OHOS::Ace::Platform {
+namespace {
+constexpr char CAPTURE_MAGIC[] = { 'A', 'I', 'P', 'C' };
+// Pointer packets are a few hundred bytes, anything larger means the capture is corrupted.
+constexpr uint32_t MAX_CAPTURED_PACKET_SIZE = 64 * 1024;
+constexpr int64_t NANOS_PER_MICRO = 1000;
+constexpr const char* STAGE_NAMES[] = { "parse", "dispatch", "ui queue", "ui handle" };
+static_assert(sizeof(STAGE_NAMES) / sizeof(STAGE_NAMES[0]) == static_cast<size_t>(InputStage::COUNT),
+    "every input stage needs a name");
+} // namespace
+
+InputLatencyRecorder& InputLatencyRecorder::GetInstance()
+{
+    static InputLatencyRecorder instance;
+    return instance;
+}
+
+InputLatencyRecorder::~InputLatencyRecorder()
+{
+    StopCapture();
+}
+
+void InputLatencyRecorder::RecordStage(InputStage stage, int64_t durationNs)
+{
+    if (stage >= InputStage::COUNT || durationNs < 0) {
+        return;
+    }
+    auto& counter = stages_[static_cast<size_t>(stage)];
+    counter.count.fetch_add(1, std::memory_order_relaxed);
+    counter.totalNs.fetch_add(durationNs, std::memory_order_relaxed);
+    int64_t max = counter.maxNs.load(std::memory_order_relaxed);
+    while (durationNs > max && !counter.maxNs.compare_exchange_weak(max, durationNs, std::memory_order_relaxed)) {
+    }
+}
+
+void InputLatencyRecorder::RecordPacket(const uint8_t* data, size_t size)
+{
+    if (IsEnabled()) {
+        packets_.fetch_add(1, std::memory_order_relaxed);
+    }
+    if (!capturing_.load(std::memory_order_relaxed) || data == nullptr || size > MAX_CAPTURED_PACKET_SIZE) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(captureMutex_);
+    if (captureFile_ == nullptr) {
+        return;
+    }
+    auto packetSize = static_cast<uint32_t>(size);
+    if (fwrite(&packetSize, sizeof(packetSize), 1, captureFile_) != 1 ||
+        fwrite(data, 1, size, captureFile_) != size) {
+        LOGW("InputLatencyRecorder capture write failed, capture stopped");
+        fclose(captureFile_);
+        captureFile_ = nullptr;
+        capturing_.store(false, std::memory_order_relaxed);
+    }
+}
+
+InputLatencyReport InputLatencyRecorder::GetReport() const
+{
+    InputLatencyReport report;
+    for (size_t index = 0; index < stages_.size(); ++index) {
+        report.stages[index].count = stages_[index].count.load(std::memory_order_relaxed);
+        report.stages[index].totalNs = stages_[index].totalNs.load(std::memory_order_relaxed);
+        report.stages[index].maxNs = stages_[index].maxNs.load(std::memory_order_relaxed);
+    }
+    report.packets = packets_.load(std::memory_order_relaxed);
+    auto poolStats = PointerEventPool::GetInstance().GetStats();
+    report.eventsAllocated = poolStats.allocated;
+    report.eventsReused = poolStats.reused;
+    return report;
+}
+
+std::string InputLatencyRecorder::DumpReport() const
+{
+    auto report = GetReport();
+    std::string result = "packets: " + std::to_string(report.packets) +
+                         ", events allocated: " + std::to_string(report.eventsAllocated) +
+                         ", events reused: " + std::to_string(report.eventsReused) + "\n";
+    for (size_t index = 0; index < report.stages.size(); ++index) {
+        const auto& stage = report.stages[index];
+        int64_t avgUs = stage.count == 0 ? 0 : stage.totalNs / static_cast<int64_t>(stage.count) / NANOS_PER_MICRO;
+        result += std::string(STAGE_NAMES[index]) + ": count " + std::to_string(stage.count) + ", avg " +
+                  std::to_string(avgUs) + "us, max " + std::to_string(stage.maxNs / NANOS_PER_MICRO) + "us\n";
+    }
+    return result;
+}
+
+void InputLatencyRecorder::Reset()
+{
+    for (auto& counter : stages_) {
+        counter.count.store(0, std::memory_order_relaxed);
+        counter.totalNs.store(0, std::memory_order_relaxed);
+        counter.maxNs.store(0, std::memory_order_relaxed);
+    }
+    packets_.store(0, std::memory_order_relaxed);
+}
+
+bool InputLatencyRecorder::StartCapture(const std::string& path)
+{
+    std::lock_guard<std::mutex> lock(captureMutex_);
+    if (captureFile_ != nullptr) {
+        fclose(captureFile_);
+    }
+    captureFile_ = fopen(path.c_str(), "wb");
+    if (captureFile_ == nullptr) {
+        LOGW("InputLatencyRecorder failed to open %{public}s, errno: %{public}d", path.c_str(), errno);
+        capturing_.store(false, std::memory_order_relaxed);
+        return false;
+    }
+    fwrite(CAPTURE_MAGIC, sizeof(CAPTURE_MAGIC), 1, captureFile_);
+    capturing_.store(true, std::memory_order_relaxed);
+    return true;
+}
+
+void InputLatencyRecorder::StopCapture()
+{
+    std::lock_guard<std::mutex> lock(captureMutex_);
+    capturing_.store(false, std::memory_order_relaxed);
+    if (captureFile_ != nullptr) {
+        fclose(captureFile_);
+        captureFile_ = nullptr;
+    }
+}
+
+int32_t InputLatencyRecorder::Replay(
+    const std::string& path, const std::function<void(const uint8_t*, size_t)>& dispatcher)
+{
+    FILE* file = fopen(path.c_str(), "rb");
+    if (file == nullptr) {
+        LOGW("InputLatencyRecorder failed to open %{public}s, errno: %{public}d", path.c_str(), errno);
+        return 0;
+    }
+    char magic[sizeof(CAPTURE_MAGIC)] = { 0 };
+    if (fread(magic, sizeof(magic), 1, file) != 1 || memcmp(magic, CAPTURE_MAGIC, sizeof(magic)) != 0) {
+        LOGW("InputLatencyRecorder %{public}s is not an input capture", path.c_str());
+        fclose(file);
+        return 0;
+    }
+    int32_t replayed = 0;
+    uint32_t packetSize = 0;
+    // Stored as uint64_t so the packet keeps the 8-byte alignment the record view requires.
+    std::vector<uint64_t> packet;
+    while (fread(&packetSize, sizeof(packetSize), 1, file) == 1 && packetSize <= MAX_CAPTURED_PACKET_SIZE) {
+        packet.resize((packetSize + sizeof(uint64_t) - 1) / sizeof(uint64_t));
+        if (fread(packet.data(), 1, packetSize, file) != packetSize) {
+            break;
+        }
+        dispatcher(reinterpret_cast<const uint8_t*>(packet.data()), packetSize);
+        ++replayed;
+    }
+    fclose(file);
+    return replayed;
+}
+
+InputStageScope::InputStageScope(InputStage stage) : stage_(stage)
+{
+    if (InputLatencyRecorder::GetInstance().IsEnabled()) {
+        begin_ = GetSysTimestamp();
+    }
+}
+
+InputStageScope::~InputStageScope()
+{
+    if (begin_ != 0) {
+        InputLatencyRecorder::GetInstance().RecordStage(stage_, GetSysTimestamp() - begin_);
+    }
+}
+} // namespace OHOS::Ace::Platform
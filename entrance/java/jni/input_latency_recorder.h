@@ -0,0 +1,112 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FOUNDATION_ACE_ADAPTER_ANDROID_ENTRANCE_JAVA_JNI_INPUT_LATENCY_RECORDER_H
+#define FOUNDATION_ACE_ADAPTER_ANDROID_ENTRANCE_JAVA_JNI_INPUT_LATENCY_RECORDER_H
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <functional>
+#include <mutex>
+#include <string>
+
+namespace OHOS::Ace::Platform {
+enum class InputStage : uint8_t {
+    // AceActionData packet to MMI::PointerEvent, CreatePointerEventsFromBytes.
+    PARSE = 0,
+    // PointerEvent to TouchEvent and hand-off to the UI thread, AceViewSG::DispatchTouchEvent.
+    DISPATCH,
+    // Time the touch task waits in the UI thread queue.
+    UI_QUEUE,
+    // PipelineContext::OnTouchEvent on the UI thread.
+    UI_HANDLE,
+    COUNT,
+};
+
+struct InputStageStats {
+    uint64_t count = 0;
+    int64_t totalNs = 0;
+    int64_t maxNs = 0;
+};
+
+struct InputLatencyReport {
+    std::array<InputStageStats, static_cast<size_t>(InputStage::COUNT)> stages {};
+    uint64_t packets = 0;
+    uint64_t eventsAllocated = 0;
+    uint64_t eventsReused = 0;
+};
+
+// Measures the touch input path per stage and captures raw pointer packets so that a recorded stream can be
+// replayed through the converters on a device. Recording is off by default and costs one relaxed load per stage.
+class InputLatencyRecorder final {
+public:
+    static InputLatencyRecorder& GetInstance();
+
+    void SetEnabled(bool enabled)
+    {
+        enabled_.store(enabled, std::memory_order_relaxed);
+    }
+
+    bool IsEnabled() const
+    {
+        return enabled_.load(std::memory_order_relaxed);
+    }
+
+    void RecordStage(InputStage stage, int64_t durationNs);
+    void RecordPacket(const uint8_t* data, size_t size);
+    InputLatencyReport GetReport() const;
+    std::string DumpReport() const;
+    void Reset();
+
+    // Appends every packet received while capturing to path, including its header.
+    bool StartCapture(const std::string& path);
+    void StopCapture();
+    // Feeds the packets of a capture file to dispatcher in order, returns the number of packets replayed.
+    static int32_t Replay(const std::string& path, const std::function<void(const uint8_t*, size_t)>& dispatcher);
+
+private:
+    struct StageCounter {
+        std::atomic<uint64_t> count { 0 };
+        std::atomic<int64_t> totalNs { 0 };
+        std::atomic<int64_t> maxNs { 0 };
+    };
+
+    InputLatencyRecorder() = default;
+    ~InputLatencyRecorder();
+    InputLatencyRecorder(const InputLatencyRecorder&) = delete;
+    InputLatencyRecorder& operator=(const InputLatencyRecorder&) = delete;
+
+    std::atomic<bool> enabled_ { false };
+    std::atomic<bool> capturing_ { false };
+    std::atomic<uint64_t> packets_ { 0 };
+    std::array<StageCounter, static_cast<size_t>(InputStage::COUNT)> stages_;
+    std::mutex captureMutex_;
+    FILE* captureFile_ = nullptr;
+};
+
+// Records the lifetime of the scope as one stage sample when recording is enabled.
+class InputStageScope final {
+public:
+    explicit InputStageScope(InputStage stage);
+    ~InputStageScope();
+
+private:
+    InputStage stage_;
+    int64_t begin_ = 0;
+};
+} // namespace OHOS::Ace::Platform
+#endif // FOUNDATION_ACE_ADAPTER_ANDROID_ENTRANCE_JAVA_JNI_INPUT_LATENCY_RECORDER_H
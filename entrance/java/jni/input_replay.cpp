@@ -0,0 +1,53 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "adapter/android/entrance/java/jni/input_replay.h"
+
+#include <memory>
+#include <vector>
+
+#include "adapter/android/entrance/java/jni/input_latency_recorder.h"
+#include "adapter/android/entrance/java/jni/mmi_event_convertor.h"
+
+namespace OHOS::Ace::Platform {
+InputReplayResult ReplayInputCapture(const std::string& path, const std::function<void(const TouchEvent&)>& sink)
+{
+    InputReplayResult result;
+    PointerActionState actionState;
+    std::vector<std::shared_ptr<MMI::PointerEvent>> pointerEvents;
+    result.packets = InputLatencyRecorder::Replay(path, [&](const uint8_t* data, size_t size) {
+        pointerEvents.clear();
+        {
+            InputStageScope stageScope(InputStage::PARSE);
+            CreatePointerEventsFromBytes(pointerEvents, InputPacketView<AceActionData>(data, size), actionState);
+        }
+        for (const auto& pointerEvent : pointerEvents) {
+            TouchEvent touchEvent;
+            {
+                InputStageScope stageScope(InputStage::DISPATCH);
+                touchEvent = ConvertTouchEvent(pointerEvent);
+            }
+            if (touchEvent.type == TouchType::UNKNOWN) {
+                continue;
+            }
+            ++result.events;
+            if (sink) {
+                sink(touchEvent);
+            }
+        }
+    });
+    return result;
+}
+} // namespace OHOS::Ace::Platform
@@ -0,0 +1,36 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FOUNDATION_ACE_ADAPTER_ANDROID_ENTRANCE_JAVA_JNI_INPUT_REPLAY_H
+#define FOUNDATION_ACE_ADAPTER_ANDROID_ENTRANCE_JAVA_JNI_INPUT_REPLAY_H
+
+#include <cstdint>
+#include <functional>
+#include <string>
+
+#include "core/event/touch_event.h"
+
+namespace OHOS::Ace::Platform {
+struct InputReplayResult {
+    int32_t packets = 0;
+    int32_t events = 0;
+};
+
+// Replays a capture of InputLatencyRecorder through CreatePointerEventsFromBytes and ConvertTouchEvent, timing
+// the parse and dispatch stages, and hands every touch event to sink. Nothing reaches a window, so a replay is
+// safe in a running app and in benchmarks.
+InputReplayResult ReplayInputCapture(const std::string& path, const std::function<void(const TouchEvent&)>& sink);
+} // namespace OHOS::Ace::Platform
+#endif // FOUNDATION_ACE_ADAPTER_ANDROID_ENTRANCE_JAVA_JNI_INPUT_REPLAY_H
@@ -17,6 +17,7 @@
 
 #include "adapter/android/entrance/java/jni/jni_environment.h"
 #include "adapter/android/entrance/java/jni/jni_registry.h"
+#include "adapter/android/osal/startup_profiler.h"
 #include "adapter/android/stage/ability/java/jni/stage_jni_registry.h"
 #include "base/log/log.h"
 #include "base/utils/utils.h"
@@ -31,6 +32,11 @@ bool JniAppModeConfig::Register()
             .signature = "()V",
             .fnPtr = reinterpret_cast<void*>(&initAppMode),
         },
+        {
+            .name = "nativeRegisterCapability",
+            .signature = "(I)V",
+            .fnPtr = reinterpret_cast<void*>(&RegisterCapability),
+        },
     };
 
     auto env = JniEnvironment::GetInstance().GetJniEnv();
@@ -58,6 +64,7 @@ void JniAppModeConfig::initAppMode(JNIEnv* env, jclass myclass)
     }
 
     LOGI("Register stage mode jni.");
+    StartupPhaseScope startupPhase(StartupPhase::CLASS_REGISTRATION);
     if (!OHOS::AbilityRuntime::Platform::StageJniRegistry::Register()) {
         LOGE("JNI Onload: failed to register StageJniRegistry");
         return;
@@ -67,4 +74,10 @@ void JniAppModeConfig::initAppMode(JNIEnv* env, jclass myclass)
         return;
     }
 }
+
+void JniAppModeConfig::RegisterCapability(JNIEnv* env, jclass myclass, jint capability)
+{
+    CHECK_NULL_VOID(env);
+    JniRegistry::RegisterCapability(static_cast<JniCapability>(capability));
+}
 } // namespace OHOS::Ace::Platform
\ No newline at end of file
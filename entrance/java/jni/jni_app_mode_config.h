@@ -29,6 +29,7 @@ public:
 
     static bool Register();
     static void initAppMode(JNIEnv* env, jclass myclass);
+    static void RegisterCapability(JNIEnv* env, jclass myclass, jint capability);
 };
 } // namespace OHOS::Ace::Platform
 #endif // FOUNDATION_ACE_ADAPTER_ANDROID_ENTRANCE_JAVA_JNI_APP_MODE_CONFIG_H
\ No newline at end of file
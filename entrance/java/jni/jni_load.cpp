@@ -16,6 +16,7 @@
 #include "jni.h"
 
 #include "adapter/android/entrance/java/jni/jni_environment.h"
+#include "adapter/android/osal/startup_profiler.h"
 #include "base/log/log.h"
 #include "base/log/ace_trace.h"
 #include "jni_app_mode_config.h"
@@ -44,6 +45,7 @@ jint JNI_OnLoad(JavaVM* vm, void*)
 
     LOGI("Current ArkUI-X version is %s, platform is Android.", ARKUI_X_VERSION);
     OHOS::Ace::AceScopedTrace aceScopedTrace("JNI_OnLoad");
+    OHOS::Ace::StartupPhaseScope startupPhase(OHOS::Ace::StartupPhase::JNI_ON_LOAD);
     std::shared_ptr<JavaVM> javaVm(vm, DummyRelease<JavaVM>);
     if (!OHOS::Ace::Platform::JniEnvironment::GetInstance().Initialize(javaVm)) {
         LOGE("JNI Onload: failed to initialize JniEnvironment");
@@ -15,6 +15,9 @@
 
 #include "adapter/android/entrance/java/jni/jni_registry.h"
 
+#include <array>
+#include <mutex>
+
 #include "adapter/android/capability/java/jni/bridge/bridge_jni.h"
 #include "adapter/android/capability/java/jni/clipboard/clipboard_jni.h"
 #include "adapter/android/capability/java/jni/editing/text_input_jni.h"
@@ -40,6 +43,25 @@
 #include "image_texture_jni.h"
 
 namespace OHOS::Ace::Platform {
+namespace {
+struct CapabilityRegistrar {
+    const char* name;
+    bool (*registerFunc)(const std::shared_ptr<JNIEnv>& env);
+};
+
+// Web and image textures are used by few apps, so their classes are not looked up on launch. The vibrator and
+// audio haptic plugins are created by AcePlatformCapability on every launch and stay in Register.
+constexpr CapabilityRegistrar CAPABILITY_REGISTRARS[] = {
+    { "WebAdapterJni", [](const std::shared_ptr<JNIEnv>& env) { return WebAdapterJni::Register(env); } },
+    { "ImageTextureJni", [](const std::shared_ptr<JNIEnv>& env) { return ImageTextureJni::Register(env); } },
+};
+static_assert(sizeof(CAPABILITY_REGISTRARS) / sizeof(CAPABILITY_REGISTRARS[0]) ==
+                  static_cast<size_t>(JniCapability::COUNT),
+    "every capability needs a registrar");
+
+std::mutex g_capabilityMutex;
+std::array<bool, static_cast<size_t>(JniCapability::COUNT)> g_capabilityRegistered {};
+} // namespace
 
 bool JniRegistry::Register()
 {
@@ -136,11 +158,6 @@ bool JniRegistry::Register()
         return false;
     }
 
-    if (!WebAdapterJni::Register(jniEnv)) {
-        LOGE("JNI Initialize: failed to register WebAdapterJni");
-        return false;
-    }
-
     if (!JsAccessibilityManagerJni::Register(jniEnv)) {
         LOGE("JNI Initialize: failed to register JsAccessibilityManagerJni");
         return false;
@@ -151,11 +168,30 @@ bool JniRegistry::Register()
         return false;
     }
 
-    if (!ImageTextureJni::Register(jniEnv)) {
-        LOGE("JNI Initialize: failed to register AndroidSurfaceTexture");
+    return true;
+}
+
+bool JniRegistry::RegisterCapability(JniCapability capability)
+{
+    if (static_cast<int32_t>(capability) < 0 || capability >= JniCapability::COUNT) {
+        LOGE("JNI Initialize: unknown capability %{public}d", static_cast<int32_t>(capability));
         return false;
     }
-
+    auto index = static_cast<size_t>(capability);
+    std::lock_guard<std::mutex> lock(g_capabilityMutex);
+    if (g_capabilityRegistered[index]) {
+        return true;
+    }
+    auto jniEnv = JniEnvironment::GetInstance().GetJniEnv();
+    if (!jniEnv) {
+        LOGE("JNI Initialize: failed to get JNI environment");
+        return false;
+    }
+    if (!CAPABILITY_REGISTRARS[index].registerFunc(jniEnv)) {
+        LOGE("JNI Initialize: failed to register %{public}s", CAPABILITY_REGISTRARS[index].name);
+        return false;
+    }
+    g_capabilityRegistered[index] = true;
     return true;
 }
 
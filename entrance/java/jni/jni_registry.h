@@ -22,9 +22,20 @@
 
 namespace OHOS::Ace::Platform {
 
+// Must match the CAPABILITY_* constants of ohos.ace.adapter.AppModeConfig.
+enum class JniCapability : int32_t {
+    WEB = 0,
+    IMAGE_TEXTURE,
+    COUNT,
+};
+
 class ACE_EXPORT JniRegistry {
 public:
+    // Registers the classes every launch needs, the others are registered by RegisterCapability.
     static bool Register();
+    // Called from the static initializer of the capability's Java class, so the natives are in place before the
+    // class is first used. Registering a capability twice is a no-op.
+    static bool RegisterCapability(JniCapability capability);
     static bool ReleaseInstance(int32_t instanceId);
 };
 
@@ -15,7 +15,10 @@
 
 #include "mmi_event_convertor.h"
 
+#include <cinttypes>
+
 #include "adapter/android/entrance/java/jni/interaction/interaction_impl.h"
+#include "adapter/android/entrance/java/jni/pointer_event_pool.h"
 #include "base/log/log.h"
 #include "base/utils/time_util.h"
 #include "base/utils/utils.h"
@@ -29,8 +32,6 @@ constexpr int8_t ACTION_POINT = 1;
 constexpr int64_t US_TO_MS = 1000;
 } // namespace
 
-static std::unordered_map<int, int> actionPointMap;
-
 SourceTool GetSourceTool(int32_t orgToolType)
 {
     switch (orgToolType) {
@@ -209,19 +210,25 @@ void ConvertPointerEvent(const std::shared_ptr<MMI::PointerEvent>& pointerEvent,
     event.targetWindowId = pointerItem.GetTargetWindowId();
 }
 
-void CreatePointerEventsFromBytes(
-    std::vector<std::shared_ptr<MMI::PointerEvent>>& pointerEvents, const std::vector<uint8_t>& data)
+void CreatePointerEventsFromBytes(std::vector<std::shared_ptr<MMI::PointerEvent>>& pointerEvents,
+    const InputPacketView<AceActionData>& packet, PointerActionState& actionState)
 {
-    const auto* origin = reinterpret_cast<const AceActionData*>(data.data());
-    size_t size = data.size() / sizeof(AceActionData);
-    auto current = const_cast<AceActionData*>(origin);
-    auto end = current + size;
+    if (packet.Empty()) {
+        return;
+    }
+    const auto* current = packet.begin();
     auto deviceId = static_cast<int32_t>(current->deviceId_);
     auto sourceType = static_cast<int32_t>(current->sourceType_);
     auto actionTime = current->actionTime_;
     auto actionType = current->actionType;
-    std::vector<OHOS::MMI::PointerEvent::PointerItem> items;
-    while (current < end) {
+    // Packets are parsed on the platform thread only, keep the item storage across packets.
+    thread_local std::vector<OHOS::MMI::PointerEvent::PointerItem> items;
+    items.clear();
+    for (; current < packet.end(); ++current) {
+        if (!PointerActionState::IsValidPointerId(current->pointerId_)) {
+            LOGW("invalid pointer id: %{public}" PRId64, current->pointerId_);
+            continue;
+        }
         OHOS::MMI::PointerEvent::PointerItem pointerItem;
         pointerItem.SetPointerId(static_cast<int32_t>(current->pointerId_));
         pointerItem.SetDownTime(current->downTime_);
@@ -235,17 +242,20 @@ void CreatePointerEventsFromBytes(
         pointerItem.SetToolType(static_cast<int32_t>(current->toolType_));
         pointerItem.SetOriginPointerId(static_cast<int32_t>(current->pointerId_));
         SetPointerItemPressed(current->actionType, pointerItem);
-        actionPointMap[current->pointerId_] = current->actionPoint;
-        current++;
+        actionState.SetActionPoint(current->pointerId_, current->actionPoint);
         items.emplace_back(pointerItem);
     }
 
     for (int i = 0; i < items.size(); i++) {
         int32_t pointerId = items[i].GetPointerId();
-        if (actionPointMap[pointerId] != ACTION_POINT) {
+        if (actionState.GetActionPoint(pointerId) != ACTION_POINT) {
             continue;
         }
-        auto pointerEvent = OHOS::MMI::PointerEvent::Create();
+        auto pointerEvent = PointerEventPool::GetInstance().Acquire();
+        if (!pointerEvent) {
+            LOGE("acquire pointer event failed.");
+            return;
+        }
         pointerEvent->SetPointerId(pointerId);
         pointerEvent->SetDeviceId(deviceId);
         pointerEvent->SetSourceType(sourceType);
@@ -310,10 +320,11 @@ void SetPointerItemPressed(AceActionData::ActionType actionType, MMI::PointerEve
 
 void ConvertMouseEvent(const std::vector<uint8_t>& data, MouseEvent& events)
 {
-    const auto* mouseActionData = reinterpret_cast<const AceMouseData*>(data.data());
-    if (!mouseActionData) {
+    if (data.size() < sizeof(AceMouseData)) {
+        LOGW("invalid mouse data, size: %{public}zu", data.size());
         return;
     }
+    const auto* mouseActionData = reinterpret_cast<const AceMouseData*>(data.data());
     std::chrono::microseconds micros(mouseActionData->timeStamp);
     TimeStamp time(micros);
     events.x = mouseActionData->physicalX;
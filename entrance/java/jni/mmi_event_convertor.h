@@ -16,6 +16,9 @@
 #ifndef FOUNDATION_ACE_ADAPTER_OHOS_ENTRANCE_MMI_EVENT_CONVERTOR_H
 #define FOUNDATION_ACE_ADAPTER_OHOS_ENTRANCE_MMI_EVENT_CONVERTOR_H
 
+#include <cstdint>
+
+#include "adapter/android/entrance/java/jni/pointer_action_state.h"
 #include "base/geometry/ng/offset_t.h"
 #include "base/geometry/ng/vector.h"
 #include "base/log/log.h"
@@ -42,8 +45,19 @@ const std::unordered_map<TouchType, int32_t> TOUCH_TYPE_MAP = {
 };
 
 const size_t DATA_ALIGNAS = 8;
+const size_t PACKET_FIELD_SIZE = 8;
+const size_t POINTER_FIELD_COUNT = 13;
+const size_t MOUSE_FIELD_COUNT = 15;
 } // namespace
 
+// Layout shared with AceEventProcessorAosp.java. Every packet starts with this header, bump the version whenever a
+// record field is added, removed or reordered on either side.
+constexpr int32_t INPUT_PACKET_VERSION = 1;
+struct InputPacketHeader {
+    int32_t version;
+    int32_t recordSize;
+};
+
 struct alignas(DATA_ALIGNAS) AceActionData {
     enum class ActionType : int64_t {
         UNKNOWN = -1,
@@ -111,15 +125,68 @@ struct alignas(DATA_ALIGNAS) AceMouseData {
     int64_t deviceType;
 };
 
+static_assert(sizeof(AceActionData) == POINTER_FIELD_COUNT * PACKET_FIELD_SIZE, "pointer packet layout changed");
+static_assert(sizeof(AceMouseData) == MOUSE_FIELD_COUNT * PACKET_FIELD_SIZE, "mouse packet layout changed");
+
+// Bounds-checked view of the records of an input packet, read in place from the Java DirectByteBuffer. The buffer
+// is only guaranteed to stay alive for the synchronous JNI dispatch, so records must be converted before it returns.
+template<typename Record>
+class InputPacketView final {
+public:
+    InputPacketView(const uint8_t* data, size_t size)
+    {
+        if (data == nullptr || size < sizeof(InputPacketHeader) ||
+            reinterpret_cast<uintptr_t>(data) % alignof(Record) != 0) {
+            LOGW("invalid input packet, size: %{public}zu", size);
+            return;
+        }
+        const auto* header = reinterpret_cast<const InputPacketHeader*>(data);
+        size_t payloadSize = size - sizeof(InputPacketHeader);
+        if (header->version != INPUT_PACKET_VERSION || header->recordSize != static_cast<int32_t>(sizeof(Record)) ||
+            payloadSize % sizeof(Record) != 0) {
+            LOGW("unsupported input packet, version: %{public}d, record size: %{public}d, size: %{public}zu",
+                header->version, header->recordSize, size);
+            return;
+        }
+        records_ = reinterpret_cast<const Record*>(data + sizeof(InputPacketHeader));
+        count_ = payloadSize / sizeof(Record);
+    }
+
+    bool Empty() const
+    {
+        return count_ == 0;
+    }
+
+    size_t Size() const
+    {
+        return count_;
+    }
+
+    const Record* begin() const
+    {
+        return records_;
+    }
+
+    const Record* end() const
+    {
+        return records_ + count_;
+    }
+
+private:
+    const Record* records_ = nullptr;
+    size_t count_ = 0;
+};
+
 void ConvertPointerEvent(const std::shared_ptr<MMI::PointerEvent>& pointerEvent, DragPointerEvent& event);
 TouchEvent ConvertTouchEvent(const std::shared_ptr<MMI::PointerEvent>& pointerEvent);
-void CreatePointerEventsFromBytes(
-    std::vector<std::shared_ptr<MMI::PointerEvent>>& pointerEvent, const std::vector<uint8_t>& data);
+void CreatePointerEventsFromBytes(std::vector<std::shared_ptr<MMI::PointerEvent>>& pointerEvent,
+    const InputPacketView<AceActionData>& packet, PointerActionState& actionState);
 void SetTouchEventType(int32_t orgAction, TouchEvent& event);
 void UpdateTouchEvent(const std::shared_ptr<MMI::PointerEvent>& pointerEvent, TouchEvent& touchEvent);
 TouchPoint ConvertTouchPoint(const MMI::PointerEvent::PointerItem& pointerItem);
 void SetPointerEventAction(AceActionData::ActionType actionType, std::shared_ptr<MMI::PointerEvent>& pointerEvent);
 void SetPointerItemPressed(AceActionData::ActionType actionType, MMI::PointerEvent::PointerItem& pointerItem);
+// data holds a single AceMouseData record without the packet header.
 void ConvertMouseEvent(const std::vector<uint8_t>& data, MouseEvent& events);
 void SetMouseEventAction(AceMouseData::Action action, MouseEvent& event);
 void SetMouseEventActionButton(AceMouseData::ActionButton actionButton, MouseEvent& event);
@@ -0,0 +1,51 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FOUNDATION_ACE_ADAPTER_ANDROID_ENTRANCE_JAVA_JNI_POINTER_ACTION_STATE_H
+#define FOUNDATION_ACE_ADAPTER_ANDROID_ENTRANCE_JAVA_JNI_POINTER_ACTION_STATE_H
+
+#include <array>
+#include <cstdint>
+
+namespace OHOS::Ace::Platform {
+// Action point flags of the pointers of one window, indexed by the Android pointer id. Each window converts its
+// packets on its own platform thread, so the state needs no locking.
+class PointerActionState final {
+public:
+    // Android pointer ids are in [0, MotionEvent.INVALID_POINTER_ID), which is at most 32 slots.
+    static constexpr int64_t MAX_POINTER_COUNT = 32;
+
+    static bool IsValidPointerId(int64_t pointerId)
+    {
+        return pointerId >= 0 && pointerId < MAX_POINTER_COUNT;
+    }
+
+    void SetActionPoint(int64_t pointerId, int8_t actionPoint)
+    {
+        if (IsValidPointerId(pointerId)) {
+            actionPoints_[pointerId] = actionPoint;
+        }
+    }
+
+    int8_t GetActionPoint(int64_t pointerId) const
+    {
+        return IsValidPointerId(pointerId) ? actionPoints_[pointerId] : 0;
+    }
+
+private:
+    std::array<int8_t, MAX_POINTER_COUNT> actionPoints_ {};
+};
+} // namespace OHOS::Ace::Platform
+#endif // FOUNDATION_ACE_ADAPTER_ANDROID_ENTRANCE_JAVA_JNI_POINTER_ACTION_STATE_H
@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "adapter/android/entrance/java/jni/pointer_event_pool.h"
+
+#include <new>
+
+namespace OHOS::Ace::Platform {
+namespace {
+// Enough for ten fingers with a few frames of events still held by gesture recognizers.
+constexpr size_t MAX_POOLED_EVENTS = 64;
+} // namespace
+
+PointerEventPool& PointerEventPool::GetInstance()
+{
+    static PointerEventPool instance;
+    return instance;
+}
+
+PointerEventPool::PointerEventPool() : state_(std::make_shared<State>())
+{
+    state_->freeEvents.reserve(MAX_POOLED_EVENTS);
+}
+
+PointerEventPool::State::~State()
+{
+    for (auto* event : freeEvents) {
+        delete event;
+    }
+}
+
+void PointerEventPool::State::Recycle(MMI::PointerEvent* event)
+{
+    // Reset drops the pointer items now instead of when the event is reused.
+    event->Reset();
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (freeEvents.size() < MAX_POOLED_EVENTS) {
+            freeEvents.emplace_back(event);
+            recycled.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+    }
+    released.fetch_add(1, std::memory_order_relaxed);
+    delete event;
+}
+
+std::shared_ptr<MMI::PointerEvent> PointerEventPool::Acquire()
+{
+    MMI::PointerEvent* event = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(state_->mutex);
+        if (!state_->freeEvents.empty()) {
+            event = state_->freeEvents.back();
+            state_->freeEvents.pop_back();
+        }
+    }
+    if (event != nullptr) {
+        state_->reused.fetch_add(1, std::memory_order_relaxed);
+    } else {
+        event = new (std::nothrow) MMI::PointerEvent(MMI::InputEvent::EVENT_TYPE_POINTER);
+        if (event == nullptr) {
+            return nullptr;
+        }
+        state_->allocated.fetch_add(1, std::memory_order_relaxed);
+    }
+    return std::shared_ptr<MMI::PointerEvent>(
+        event, [state = state_](MMI::PointerEvent* released) { state->Recycle(released); });
+}
+
+PointerEventPoolStats PointerEventPool::GetStats() const
+{
+    PointerEventPoolStats stats;
+    stats.allocated = state_->allocated.load(std::memory_order_relaxed);
+    stats.reused = state_->reused.load(std::memory_order_relaxed);
+    stats.recycled = state_->recycled.load(std::memory_order_relaxed);
+    stats.released = state_->released.load(std::memory_order_relaxed);
+    return stats;
+}
+} // namespace OHOS::Ace::Platform
@@ -0,0 +1,67 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FOUNDATION_ACE_ADAPTER_ANDROID_ENTRANCE_JAVA_JNI_POINTER_EVENT_POOL_H
+#define FOUNDATION_ACE_ADAPTER_ANDROID_ENTRANCE_JAVA_JNI_POINTER_EVENT_POOL_H
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "pointer_event.h"
+
+namespace OHOS::Ace::Platform {
+struct PointerEventPoolStats {
+    uint64_t allocated = 0;
+    uint64_t reused = 0;
+    uint64_t recycled = 0;
+    uint64_t released = 0;
+};
+
+// Recycles MMI::PointerEvent objects created for Android touch packets. Events are handed out as shared_ptr whose
+// deleter puts them back into the pool, so an event returns only after the UI thread and every gesture recognizer
+// holding it have dropped their references.
+class PointerEventPool final {
+public:
+    static PointerEventPool& GetInstance();
+
+    std::shared_ptr<MMI::PointerEvent> Acquire();
+    PointerEventPoolStats GetStats() const;
+
+private:
+    struct State {
+        std::mutex mutex;
+        std::vector<MMI::PointerEvent*> freeEvents;
+        std::atomic<uint64_t> allocated { 0 };
+        std::atomic<uint64_t> reused { 0 };
+        std::atomic<uint64_t> recycled { 0 };
+        std::atomic<uint64_t> released { 0 };
+
+        ~State();
+        void Recycle(MMI::PointerEvent* event);
+    };
+
+    PointerEventPool();
+    ~PointerEventPool() = default;
+    PointerEventPool(const PointerEventPool&) = delete;
+    PointerEventPool& operator=(const PointerEventPool&) = delete;
+
+    // Shared with every outstanding deleter, so events released after the pool is gone are still freed safely.
+    std::shared_ptr<State> state_;
+};
+} // namespace OHOS::Ace::Platform
+#endif // FOUNDATION_ACE_ADAPTER_ANDROID_ENTRANCE_JAVA_JNI_POINTER_EVENT_POOL_H
@@ -33,7 +33,10 @@
 #include "window_view_jni.h"
 
 #include "adapter/android/entrance/java/jni/ace_env_jni.h"
+#include "adapter/android/entrance/java/jni/input_latency_recorder.h"
 #include "adapter/android/entrance/java/jni/jni_environment.h"
+#include "adapter/android/osal/frame_phase_recorder.h"
+#include "adapter/android/osal/startup_profiler.h"
 #include "base/log/log.h"
 #include "base/utils/utils.h"
 #include "core/event/touch_event.h"
@@ -822,7 +825,13 @@ void Window::RequestVsync(const std::shared_ptr<VsyncCallback>& vsyncCallback)
     // stage model
     if (receiver_) {
         SetUpThreadInfo();
-        auto callback = [vsyncCallback](int64_t timestamp, void*) { vsyncCallback->onCallback(timestamp, 0); };
+        auto callback = [vsyncCallback](int64_t timestamp, void*) {
+            Ace::StartupProfiler::GetInstance().OnFrameBegin();
+            vsyncCallback->onCallback(timestamp, 0);
+            // The FrameReport hooks only run while phase recording is on, the frame signals come from here.
+            Ace::FramePhaseRecorder::GetInstance().NotifyFrameDone();
+            Ace::StartupProfiler::GetInstance().OnFrameEnd();
+        };
         VSyncReceiver::FrameCallback fcb = {
             .userData_ = this,
             .callback_ = callback,
@@ -1093,14 +1102,18 @@ bool Window::ProcessBasicEvent(const std::vector<Ace::TouchEvent>& touchEvents)
     return uiContent_->ProcessBasicEvent(touchEvents);
 }
 
-bool Window::ProcessPointerEvent(const std::vector<uint8_t>& data)
+bool Window::ProcessPointerEvent(const uint8_t* data, size_t size)
 {
     if (!uiContent_) {
         LOGW("Window::ProcessPointerEvent uiContent_ is nullptr");
         return false;
     }
+    InputLatencyRecorder::GetInstance().RecordPacket(data, size);
     std::vector<std::shared_ptr<MMI::PointerEvent>> pointerEvents;
-    CreatePointerEventsFromBytes(pointerEvents, data);
+    {
+        InputStageScope stageScope(InputStage::PARSE);
+        CreatePointerEventsFromBytes(pointerEvents, InputPacketView<AceActionData>(data, size), pointerActionState_);
+    }
     bool result = true;
     for (auto& pointerEvent : pointerEvents) {
         result &= uiContent_->ProcessPointerEvent(pointerEvent);
@@ -1108,13 +1121,21 @@ bool Window::ProcessPointerEvent(const std::vector<uint8_t>& data)
     return result;
 }
 
-bool Window::ProcessMouseEvent(const std::vector<uint8_t>& data)
+bool Window::ProcessMouseEvent(const uint8_t* data, size_t size)
 {
     if (!uiContent_) {
         LOGW("Window::ProcessMouseEvent uiContent_ is nullptr");
         return false;
     }
-    return uiContent_->ProcessMouseEvent(data);
+    InputPacketView<AceMouseData> packet(data, size);
+    if (packet.Empty()) {
+        return false;
+    }
+    // UIContent takes the record as a vector, reuse the storage instead of allocating one per event.
+    thread_local std::vector<uint8_t> record;
+    const auto* begin = reinterpret_cast<const uint8_t*>(packet.begin());
+    record.assign(begin, begin + sizeof(AceMouseData));
+    return uiContent_->ProcessMouseEvent(record);
 }
 
 bool Window::ProcessKeyEvent(int32_t keyCode, int32_t keyAction, int32_t repeatTime, int64_t timeStamp,
@@ -26,6 +26,7 @@
 #include "render_service_client/core/ui/rs_ui_director.h"
 
 #include "adapter/android/entrance/java/jni/jni_environment.h"
+#include "adapter/android/entrance/java/jni/pointer_action_state.h"
 #include "adapter/android/entrance/java/jni/window_view_jni.h"
 #include "base/log/log.h"
 #include "base/utils/noncopyable.h"
@@ -171,8 +172,9 @@ public:
     // event process
     bool ProcessBackPressed();
     bool ProcessBasicEvent(const std::vector<Ace::TouchEvent>& touchEvents);
-    bool ProcessPointerEvent(const std::vector<uint8_t>& data);
-    bool ProcessMouseEvent(const std::vector<uint8_t>& data);
+    // data points into the Java packet buffer and is only read until these return.
+    bool ProcessPointerEvent(const uint8_t* data, size_t size);
+    bool ProcessMouseEvent(const uint8_t* data, size_t size);
     bool ProcessKeyEvent(int32_t keyCode, int32_t keyAction, int32_t repeatTime, int64_t timeStamp = 0,
         int64_t timeStampStart = 0, int32_t source = 0, int32_t deviceId = 0, int32_t metaKey = 0);
 
@@ -397,6 +399,7 @@ private:
     jobject windowView_ = nullptr;
     std::shared_ptr<AbilityRuntime::Platform::Context> context_ = nullptr;
     std::unique_ptr<OHOS::Ace::Platform::UIContent> uiContent_;
+    Ace::Platform::PointerActionState pointerActionState_;
 
     std::shared_ptr<VSyncReceiver> receiver_ = nullptr;
 
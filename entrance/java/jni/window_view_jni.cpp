@@ -96,6 +96,20 @@ static const JNINativeMethod COMMON_METHODS[] = {
         .fnPtr = reinterpret_cast<void*>(&WindowViewJni::AvoidAreaChange),
     },
 };
+
+// The caller keeps the buffer reachable for the whole dispatch, its address is read in place without a copy.
+const uint8_t* GetPacketData(JNIEnv* env, jobject buffer, jint position, size_t& size)
+{
+    const auto* data = static_cast<const uint8_t*>(env->GetDirectBufferAddress(buffer));
+    jlong capacity = env->GetDirectBufferCapacity(buffer);
+    if (data == nullptr || position < 0 || capacity < position) {
+        LOGE("invalid packet buffer, position: %{public}d, capacity: %{public}lld", position,
+            static_cast<long long>(capacity));
+        return nullptr;
+    }
+    size = static_cast<size_t>(position);
+    return data;
+}
 } // namespace
 
 void WindowViewJni::SurfaceCreated(JNIEnv* env, jobject myObject, jlong window, jobject jsurface)
@@ -220,15 +234,15 @@ jboolean WindowViewJni::DispatchPointerDataPacket(
         return false;
     }
 
-    uint8_t* data = static_cast<uint8_t*>(env->GetDirectBufferAddress(buffer));
-    std::vector<uint8_t> packet(data, data + position);
+    size_t size = 0;
+    const uint8_t* data = GetPacketData(env, buffer, position, size);
     auto windowPtr = JavaLongToPointer<Rosen::Window>(window);
-    if (windowPtr == nullptr) {
-        LOGE("DispatchPointerDataPacket window is nullptr");
+    if (data == nullptr || windowPtr == nullptr) {
+        LOGE("DispatchPointerDataPacket window or packet is invalid");
         return false;
     }
 
-    return windowPtr->ProcessPointerEvent(packet);
+    return windowPtr->ProcessPointerEvent(data, size);
 }
 
 jboolean WindowViewJni::DispatchMouseDataPacket(
@@ -239,14 +253,14 @@ jboolean WindowViewJni::DispatchMouseDataPacket(
         return false;
     }
 
-    uint8_t* data = static_cast<uint8_t*>(env->GetDirectBufferAddress(buffer));
-    std::vector<uint8_t> packet(data, data + position);
+    size_t size = 0;
+    const uint8_t* data = GetPacketData(env, buffer, position, size);
     auto windowPtr = JavaLongToPointer<Rosen::Window>(window);
-    if (windowPtr == nullptr) {
-        LOGE("DispatchMouseDataPacket window is nullptr");
+    if (data == nullptr || windowPtr == nullptr) {
+        LOGE("DispatchMouseDataPacket window or packet is invalid");
         return false;
     }
-    return windowPtr->ProcessMouseEvent(packet);
+    return windowPtr->ProcessMouseEvent(data, size);
 }
 
 jboolean WindowViewJni::DispatchKeyEvent(JNIEnv* env, jobject myObject, jlong window, jint keyCode, jint action,
@@ -33,6 +33,11 @@ public class AceEventProcessorAosp {
     private static final double TOUCH_ATCION_MULTI = 2.0D;
     private static final long TOUCH_EVENT_TIMEUNIT = 1000L;
     private static final int BYTES_PER_FIELD = 8;
+    /**
+     * Packet layout version, must match INPUT_PACKET_VERSION in mmi_event_convertor.h.
+     */
+    private static final int PACKET_VERSION = 1;
+    private static final int PACKET_HEADER_SIZE = 8;
 
     private AceEventProcessorAosp() {
     }
@@ -264,6 +269,15 @@ public class AceEventProcessorAosp {
         int TOUCHPAD = 8;
     };
 
+    private static ByteBuffer allocatePacket(int recordCount, int fieldCount) {
+        int recordSize = fieldCount * BYTES_PER_FIELD;
+        ByteBuffer packet = ByteBuffer.allocateDirect(PACKET_HEADER_SIZE + recordCount * recordSize);
+        packet.order(ByteOrder.LITTLE_ENDIAN);
+        packet.putInt(PACKET_VERSION);
+        packet.putInt(recordSize);
+        return packet;
+    }
+
     /**
      * Process system motion events
      *
@@ -278,8 +292,7 @@ public class AceEventProcessorAosp {
         int pointerCount = event.getPointerCount();
 
         // Prepare data packet.
-        ByteBuffer packet = ByteBuffer.allocateDirect(pointerCount * PONITER_FIELD_COUNT * BYTES_PER_FIELD);
-        packet.order(ByteOrder.LITTLE_ENDIAN);
+        ByteBuffer packet = allocatePacket(pointerCount, PONITER_FIELD_COUNT);
 
         int actionMasked = event.getActionMasked();
         int actionType = actionMaskedToActionType(actionMasked);
@@ -288,7 +301,7 @@ public class AceEventProcessorAosp {
             addEventToBuffer(event, index, actionType, packet);
         }
         // verify the size of packet.
-        if (packet.position() % (PONITER_FIELD_COUNT * BYTES_PER_FIELD) != 0) {
+        if ((packet.position() - PACKET_HEADER_SIZE) % (PONITER_FIELD_COUNT * BYTES_PER_FIELD) != 0) {
             throw new AssertionError("Packet position is not multiple of pointer length");
         }
 
@@ -309,8 +322,7 @@ public class AceEventProcessorAosp {
         int pointerCount = event.getPointerCount();
 
         // Prepare data packet.
-        ByteBuffer packet = ByteBuffer.allocateDirect(pointerCount * PONITER_FIELD_COUNT * BYTES_PER_FIELD);
-        packet.order(ByteOrder.LITTLE_ENDIAN);
+        ByteBuffer packet = allocatePacket(pointerCount, PONITER_FIELD_COUNT);
 
         int actionMasked = event.getActionMasked();
         int actionType = actionMaskToHoverActionType(actionMasked);
@@ -320,7 +332,7 @@ public class AceEventProcessorAosp {
         }
 
         // verify the size of packet.
-        if (packet.position() % (PONITER_FIELD_COUNT * BYTES_PER_FIELD) != 0) {
+        if ((packet.position() - PACKET_HEADER_SIZE) % (PONITER_FIELD_COUNT * BYTES_PER_FIELD) != 0) {
             throw new AssertionError("Packet position is not multiple of pointer length");
         }
 
@@ -393,8 +405,7 @@ public class AceEventProcessorAosp {
         int pointerCount = event.getPointerCount();
 
         // Prepare data packet.
-        ByteBuffer packet = ByteBuffer.allocateDirect(pointerCount * MOUSE_FIELD_COUNT * BYTES_PER_FIELD);
-        packet.order(ByteOrder.LITTLE_ENDIAN);
+        ByteBuffer packet = allocatePacket(pointerCount, MOUSE_FIELD_COUNT);
 
         int actionMasked = actionKey & 15;
         int mouseKey = actionKey >> 4;
@@ -410,7 +421,7 @@ public class AceEventProcessorAosp {
         }
 
         // verify the size of packet.
-        if (packet.position() % (MOUSE_FIELD_COUNT * BYTES_PER_FIELD) != 0) {
+        if ((packet.position() - PACKET_HEADER_SIZE) % (MOUSE_FIELD_COUNT * BYTES_PER_FIELD) != 0) {
             throw new AssertionError("Packet position is not multiple of pointer length");
         }
 
@@ -431,8 +442,7 @@ public class AceEventProcessorAosp {
         }
 
         // Prepare data packet.
-        ByteBuffer packet = ByteBuffer.allocateDirect(MOUSE_FIELD_COUNT * BYTES_PER_FIELD);
-        packet.order(ByteOrder.LITTLE_ENDIAN);
+        ByteBuffer packet = allocatePacket(1, MOUSE_FIELD_COUNT);
 
         int action = event.getAction();
         int actionType;
@@ -446,7 +456,7 @@ public class AceEventProcessorAosp {
         addMouseToBuffer(event, actionType, packet, x, y);
 
         // verify the size of packet.
-        if (packet.position() % (MOUSE_FIELD_COUNT * BYTES_PER_FIELD) != 0) {
+        if ((packet.position() - PACKET_HEADER_SIZE) % (MOUSE_FIELD_COUNT * BYTES_PER_FIELD) != 0) {
             throw new AssertionError("Packet position is not multiple of pointer length");
         }
         return packet;
@@ -21,6 +21,16 @@ package ohos.ace.adapter;
  * @since 2023-08-06
  */
 public class AppModeConfig {
+    /**
+     * Capability of AceWebBase, must match JniCapability in jni_registry.h.
+     */
+    public static final int CAPABILITY_WEB = 0;
+
+    /**
+     * Capability of AceImageTexture.
+     */
+    public static final int CAPABILITY_IMAGE_TEXTURE = 1;
+
     private AppModeConfig() {}
 
     /**
@@ -30,5 +40,17 @@ public class AppModeConfig {
         nativeInitAppMode();
     }
 
+    /**
+     * Register the natives of a capability that is not registered on launch.
+     * Call it from the static initializer of the capability class.
+     *
+     * @param capability one of the CAPABILITY_* constants
+     */
+    public static void registerCapability(int capability) {
+        nativeRegisterCapability(capability);
+    }
+
     private static native void nativeInitAppMode();
+
+    private static native void nativeRegisterCapability(int capability);
 }
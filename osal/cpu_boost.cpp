@@ -15,8 +15,28 @@
 
 #include "base/utils/cpu_boost.h"
 
+#include <atomic>
+
+#include "adapter/android/osal/thread_sched_policy.h"
+
 namespace OHOS::Ace {
-void FlushDirtyNodeCpuBoostOperate(bool flag) {}
+namespace {
+std::atomic<bool> g_flushDirtyNodeBoosting { false };
+std::atomic<bool> g_displaySyncBoosting { false };
+} // namespace
+
+// The engine reports the on state every frame while busy, only the transition to on starts a boost.
+void FlushDirtyNodeCpuBoostOperate(bool flag)
+{
+    if (g_flushDirtyNodeBoosting.exchange(flag, std::memory_order_relaxed) != flag && flag) {
+        ThreadSchedPolicy::GetInstance().Boost(BoostScene::FLUSH_DIRTY_NODE);
+    }
+}
 
-void DisplaysyncCpuBoostOperate(bool flag) {}
+void DisplaysyncCpuBoostOperate(bool flag)
+{
+    if (g_displaySyncBoosting.exchange(flag, std::memory_order_relaxed) != flag && flag) {
+        ThreadSchedPolicy::GetInstance().Boost(BoostScene::DISPLAY_SYNC);
+    }
 }
+} // namespace OHOS::Ace
@@ -18,6 +18,7 @@
 #include <dlfcn.h>
 #include <memory>
 
+#include "adapter/android/osal/dynamic_module_preloader.h"
 #include "base/log/log_wrapper.h"
 #include "base/utils/utils.h"
 #include "compatible/components/component_loader.h"
@@ -62,6 +63,17 @@ const std::unordered_map<std::string, std::string> soMap = {
     {"TextClock", "textclock"},
 };
 } // namespace
+
+bool GetDynamicModuleLibName(const std::string& moduleName, std::string& libName)
+{
+    auto it = soMap.find(moduleName);
+    if (it == soMap.end()) {
+        return false;
+    }
+    libName = DYNAMIC_MODULE_LIB_PREFIX + it->second + DYNAMIC_MODULE_LIB_POSTFIX;
+    return true;
+}
+
 DynamicModuleHelper& DynamicModuleHelper::GetInstance()
 {
     static DynamicModuleHelper instance;
@@ -83,13 +95,12 @@ DynamicModule* DynamicModuleHelper::GetDynamicModule(const std::string& name)
             return iter->second.get();
         }
     }
-    auto it = soMap.find(name);
-    if (it == soMap.end()) {
+    std::string libName;
+    if (!GetDynamicModuleLibName(name, libName)) {
         LOGE("No shared library mapping found for nativeModule: %{public}s", name.c_str());
         return nullptr;
     }
     // Load module without holding the lock (dlopen/dlsym may be slow)
-    auto libName = DYNAMIC_MODULE_LIB_PREFIX + it->second + DYNAMIC_MODULE_LIB_POSTFIX;
     auto* handle = dlopen(libName.c_str(), RTLD_LAZY);
     LOGI("First load %{public}s nativeModule start", name.c_str());
     if (handle == nullptr) {
@@ -122,8 +133,9 @@ DynamicModule* DynamicModuleHelper::GetDynamicModule(const std::string& name)
             return iter->second.get();
         }
         moduleMap_.emplace(name, std::unique_ptr<DynamicModule>(module));
-        return module;
     }
+    DynamicModulePreloader::GetInstance().RecordUsage(name);
+    return module;
 }
 
 bool DynamicModuleHelper::IsDynamicModuleLoaded(const std::string& name)
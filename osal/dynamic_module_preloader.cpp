@@ -0,0 +1,156 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "adapter/android/osal/dynamic_module_preloader.h"
+
+#include <dlfcn.h>
+
+#include <cerrno>
+#include <cstdio>
+#include <fstream>
+
+#include "base/log/log.h"
+#include "base/thread/background_task_executor.h"
+
+namespace OHOS::Ace {
+namespace {
+constexpr char PROFILE_TMP_POSTFIX[] = ".tmp";
+} // namespace
+
+DynamicModulePreloader& DynamicModulePreloader::GetInstance()
+{
+    static DynamicModulePreloader instance;
+    return instance;
+}
+
+void DynamicModulePreloader::SetProfilePath(const std::string& profilePath)
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        profilePath_ = profilePath;
+    }
+    BackgroundTaskExecutor::GetInstance().PostTask([profilePath]() {
+        auto moduleNames = ReadProfile(profilePath);
+        if (moduleNames.empty()) {
+            return;
+        }
+        auto& preloader = DynamicModulePreloader::GetInstance();
+        {
+            std::lock_guard<std::mutex> lock(preloader.mutex_);
+            preloader.profileModules_.insert(moduleNames.begin(), moduleNames.end());
+        }
+        preloader.PreloadLibraries(moduleNames);
+    });
+}
+
+void DynamicModulePreloader::Preload(const std::vector<std::string>& moduleNames)
+{
+    if (moduleNames.empty()) {
+        return;
+    }
+    BackgroundTaskExecutor::GetInstance().PostTask(
+        [moduleNames]() { DynamicModulePreloader::GetInstance().PreloadLibraries(moduleNames); });
+}
+
+void DynamicModulePreloader::RecordUsage(const std::string& moduleName)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (profileModules_.insert(moduleName).second) {
+        profileDirty_ = true;
+    }
+}
+
+void DynamicModulePreloader::Flush()
+{
+    std::string profilePath;
+    std::set<std::string> moduleNames;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!profileDirty_ || profilePath_.empty()) {
+            return;
+        }
+        profileDirty_ = false;
+        profilePath = profilePath_;
+        moduleNames = profileModules_;
+    }
+    BackgroundTaskExecutor::GetInstance().PostTask(
+        [profilePath, moduleNames = std::move(moduleNames)]() { WriteProfile(profilePath, moduleNames); });
+}
+
+void DynamicModulePreloader::PreloadLibraries(const std::vector<std::string>& moduleNames)
+{
+    for (const auto& moduleName : moduleNames) {
+        std::string libName;
+        if (!GetDynamicModuleLibName(moduleName, libName)) {
+            continue;
+        }
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (handles_.count(libName) > 0) {
+                continue;
+            }
+        }
+        // Binds every symbol now, so the dlopen of the UI thread only takes a reference.
+        auto* handle = dlopen(libName.c_str(), RTLD_NOW);
+        if (handle == nullptr) {
+            LOGW("Preload dynamic module %{public}s failed, error: %{public}s", moduleName.c_str(), dlerror());
+            continue;
+        }
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!handles_.emplace(libName, handle).second) {
+            dlclose(handle);
+        }
+    }
+}
+
+std::vector<std::string> DynamicModulePreloader::ReadProfile(const std::string& profilePath)
+{
+    std::vector<std::string> moduleNames;
+    std::ifstream file(profilePath);
+    if (!file.is_open()) {
+        return moduleNames;
+    }
+    std::string libName;
+    for (std::string line; std::getline(file, line);) {
+        // Modules of an older engine version may have been removed from the table since the profile was written.
+        if (GetDynamicModuleLibName(line, libName)) {
+            moduleNames.emplace_back(std::move(line));
+        }
+    }
+    return moduleNames;
+}
+
+void DynamicModulePreloader::WriteProfile(const std::string& profilePath, const std::set<std::string>& moduleNames)
+{
+    std::string tmpPath = profilePath + PROFILE_TMP_POSTFIX;
+    {
+        std::ofstream file(tmpPath, std::ios::trunc);
+        if (!file.is_open()) {
+            LOGW("Open dynamic module profile %{public}s failed, errno: %{public}d", tmpPath.c_str(), errno);
+            return;
+        }
+        for (const auto& moduleName : moduleNames) {
+            file << moduleName << '\n';
+        }
+        if (!file.good()) {
+            LOGW("Write dynamic module profile %{public}s failed", tmpPath.c_str());
+            return;
+        }
+    }
+    if (std::rename(tmpPath.c_str(), profilePath.c_str()) != 0) {
+        LOGW("Rename dynamic module profile failed, errno: %{public}d", errno);
+    }
+}
+} // namespace OHOS::Ace
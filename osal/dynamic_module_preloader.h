@@ -0,0 +1,62 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FOUNDATION_ACE_ADAPTER_ANDROID_OSAL_DYNAMIC_MODULE_PRELOADER_H
+#define FOUNDATION_ACE_ADAPTER_ANDROID_OSAL_DYNAMIC_MODULE_PRELOADER_H
+
+#include <mutex>
+#include <set>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace OHOS::Ace {
+// Maps a component name such as "TextClock" to its library, "libarkui_textclock.so". Defined next to the module
+// table in dynamic_module_helper.cpp.
+bool GetDynamicModuleLibName(const std::string& moduleName, std::string& libName);
+
+// Opens the libraries of dynamic component modules on a background thread before the UI thread first creates one
+// of their components. The modules created by an app are kept in a per-app profile and preloaded on the next launch.
+class DynamicModulePreloader final {
+public:
+    static DynamicModulePreloader& GetInstance();
+
+    // Sets the profile file and preloads the modules it lists.
+    void SetProfilePath(const std::string& profilePath);
+    void Preload(const std::vector<std::string>& moduleNames);
+    // Called when the UI thread creates a module, new modules are written to the profile on the next flush.
+    void RecordUsage(const std::string& moduleName);
+    // Schedules the profile to be written on a background thread if it changed.
+    void Flush();
+
+private:
+    DynamicModulePreloader() = default;
+    ~DynamicModulePreloader() = default;
+    DynamicModulePreloader(const DynamicModulePreloader&) = delete;
+    DynamicModulePreloader& operator=(const DynamicModulePreloader&) = delete;
+
+    void PreloadLibraries(const std::vector<std::string>& moduleNames);
+    static std::vector<std::string> ReadProfile(const std::string& profilePath);
+    static void WriteProfile(const std::string& profilePath, const std::set<std::string>& moduleNames);
+
+    std::mutex mutex_;
+    std::string profilePath_;
+    std::set<std::string> profileModules_;
+    bool profileDirty_ = false;
+    // Preloaded libraries stay open, the modules created from them are never unloaded either.
+    std::unordered_map<std::string, void*> handles_;
+};
+} // namespace OHOS::Ace
+#endif // FOUNDATION_ACE_ADAPTER_ANDROID_OSAL_DYNAMIC_MODULE_PRELOADER_H
@@ -15,35 +15,97 @@
 
 #include "base/log/event_report.h"
 
-namespace OHOS::Ace {
-void EventReport::SendEvent(const EventInfo& eventInfo) {}
-
-void EventReport::SendAppStartException(AppStartExcepType type) {}
-
-void EventReport::SendPageRouterException(PageRouterExcepType type, const std::string& pageUrl) {}
-
-void EventReport::SendComponentException(ComponentExcepType type) {}
-
-void EventReport::SendComponentExceptionNG(
-    ComponentExcepTypeNG type, int32_t nodeType, int32_t nodeId, const std::string& message) {}
+#include <mutex>
+#include <unordered_map>
 
-void EventReport::ReportPageLoadTimeout(const EventInfo& eventInfo) {}
+#include "adapter/android/osal/perf_event_sink.h"
+#include "base/utils/time_util.h"
 
-void EventReport::SendAPIChannelException(APIChannelExcepType type) {}
-
-void EventReport::SendRenderException(RenderExcepType type) {}
-
-void EventReport::SendJsException(JsExcepType type) {}
+namespace OHOS::Ace {
+namespace {
+constexpr int64_t NANOS_PER_MILLI = 1000000;
+constexpr size_t MAX_PENDING_SCENES = 64;
+// A scene whose end is not reported within this time is dropped.
+constexpr int64_t SCENE_EXPIRE_NS = 60LL * 1000 * NANOS_PER_MILLI;
+
+std::mutex g_sceneMutex;
+// Scene name to start time in ns, frame rate durations are recorded once a scene ends.
+std::unordered_map<std::string, int64_t> g_sceneStartTimes;
+
+template<typename T>
+void RecordException(const char* category, T type)
+{
+    PerfEventSink::GetInstance().Record(PerfEventType::EXCEPTION, category, static_cast<int32_t>(type), 1);
+}
+} // namespace
 
-void EventReport::SendAnimationException(AnimationExcepType type) {}
+void EventReport::SendEvent(const EventInfo& eventInfo) {}
 
-void EventReport::SendEventException(EventExcepType type) {}
+void EventReport::SendAppStartException(AppStartExcepType type)
+{
+    RecordException("app_start", type);
+}
 
-void EventReport::SendInternalException(InternalExcepType type) {}
+void EventReport::SendPageRouterException(PageRouterExcepType type, const std::string& pageUrl)
+{
+    RecordException("page_router", type);
+}
 
-void EventReport::SendAccessibilityException(AccessibilityExcepType type) {}
+void EventReport::SendComponentException(ComponentExcepType type)
+{
+    RecordException("component", type);
+}
 
-void EventReport::SendFormException(FormExcepType type) {}
+void EventReport::SendComponentExceptionNG(
+    ComponentExcepTypeNG type, int32_t nodeType, int32_t nodeId, const std::string& message)
+{
+    RecordException("component_ng", type);
+}
+
+void EventReport::ReportPageLoadTimeout(const EventInfo& eventInfo)
+{
+    PerfEventSink::GetInstance().Record(PerfEventType::PAGE_LOAD_TIMEOUT, "", 0, 1);
+}
+
+void EventReport::SendAPIChannelException(APIChannelExcepType type)
+{
+    RecordException("api_channel", type);
+}
+
+void EventReport::SendRenderException(RenderExcepType type)
+{
+    RecordException("render", type);
+}
+
+void EventReport::SendJsException(JsExcepType type)
+{
+    RecordException("js", type);
+}
+
+void EventReport::SendAnimationException(AnimationExcepType type)
+{
+    RecordException("animation", type);
+}
+
+void EventReport::SendEventException(EventExcepType type)
+{
+    RecordException("event", type);
+}
+
+void EventReport::SendInternalException(InternalExcepType type)
+{
+    RecordException("internal", type);
+}
+
+void EventReport::SendAccessibilityException(AccessibilityExcepType type)
+{
+    RecordException("accessibility", type);
+}
+
+void EventReport::SendFormException(FormExcepType type)
+{
+    RecordException("form", type);
+}
 
 void EventReport::JsEventReport(int32_t eventType, const std::string& jsonStr) {}
 
@@ -57,7 +119,16 @@ void EventReport::ANRShowDialog(int32_t uid, const std::string& packageName,
                                 const std::string& processName, const std::string& msg) {}
 
 void EventReport::JankFrameReport(int64_t startTime, int64_t duration, const std::vector<uint16_t>& jank,
-                                  const std::string& pageUrl, uint32_t jankStatusVersion) {}
+                                  const std::string& pageUrl, uint32_t jankStatusVersion)
+{
+    auto& sink = PerfEventSink::GetInstance();
+    sink.Record(PerfEventType::JANK_DURATION, pageUrl, 0, duration);
+    for (size_t bucket = 0; bucket < jank.size(); ++bucket) {
+        if (jank[bucket] > 0) {
+            sink.Record(PerfEventType::JANK_FRAME, pageUrl, static_cast<int32_t>(bucket), jank[bucket]);
+        }
+    }
+}
 
 void EventReport::SendEventInner(const EventInfo& eventInfo) {}
 
@@ -65,11 +136,20 @@ void EventReport::ReportDoubleClickTitle(int32_t stateChange) {}
 
 void EventReport::ReportClickTitleMaximizeMenu(int32_t maxMenuItem, int32_t stateChange) {}
 
-void EventReport::ReportPageNodeOverflow(const std::string& pageUrl, int32_t nodeCount, int32_t threshold) {}
+void EventReport::ReportPageNodeOverflow(const std::string& pageUrl, int32_t nodeCount, int32_t threshold)
+{
+    PerfEventSink::GetInstance().Record(PerfEventType::PAGE_NODE_OVERFLOW, pageUrl, threshold, nodeCount);
+}
 
-void EventReport::ReportPageDepthOverflow(const std::string& pageUrl, int32_t depth, int32_t threshold) {}
+void EventReport::ReportPageDepthOverflow(const std::string& pageUrl, int32_t depth, int32_t threshold)
+{
+    PerfEventSink::GetInstance().Record(PerfEventType::PAGE_DEPTH_OVERFLOW, pageUrl, threshold, depth);
+}
 
-void EventReport::ReportFunctionTimeout(const std::string& functionName, int64_t time, int32_t threshold) {}
+void EventReport::ReportFunctionTimeout(const std::string& functionName, int64_t time, int32_t threshold)
+{
+    PerfEventSink::GetInstance().Record(PerfEventType::FUNCTION_TIMEOUT, functionName, threshold, time);
+}
 
 void EventReport::ReportUiExtensionTransparentEvent(const std::string& pageUrl, const std::string& bundleName,
     const std::string& moduleName) {}
@@ -90,7 +170,36 @@ void EventReport::ReportScrollableErrorEvent(
 void EventReport::ReportRichEditorInfo(const RichEditorInfo& richEditorInfo) {}
 
 void EventReport::FrameRateDurationsStatistics(int32_t expectedRate, const std::string& scene, NG::SceneStatus status)
-{}
+{
+    int64_t now = GetSysTimestamp();
+    int64_t startTime = 0;
+    {
+        std::lock_guard<std::mutex> lock(g_sceneMutex);
+        if (status == NG::SceneStatus::START) {
+            if (g_sceneStartTimes.size() >= MAX_PENDING_SCENES && g_sceneStartTimes.count(scene) == 0) {
+                for (auto iter = g_sceneStartTimes.begin(); iter != g_sceneStartTimes.end();) {
+                    iter = (now - iter->second >= SCENE_EXPIRE_NS) ? g_sceneStartTimes.erase(iter) : ++iter;
+                }
+                if (g_sceneStartTimes.size() >= MAX_PENDING_SCENES) {
+                    return;
+                }
+            }
+            g_sceneStartTimes[scene] = now;
+            return;
+        }
+        if (status != NG::SceneStatus::END) {
+            return;
+        }
+        auto iter = g_sceneStartTimes.find(scene);
+        if (iter == g_sceneStartTimes.end()) {
+            return;
+        }
+        startTime = iter->second;
+        g_sceneStartTimes.erase(iter);
+    }
+    PerfEventSink::GetInstance().Record(
+        PerfEventType::FRAME_RATE_DURATION, scene, expectedRate, (now - startTime) / NANOS_PER_MILLI);
+}
 
 void EventReport::ReportPageSlidInfo(NG::SlidInfo &slidInfo) {}
 
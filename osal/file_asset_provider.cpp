@@ -17,12 +17,19 @@
 
 #include <dirent.h>
 #include <limits>
+#include <sys/stat.h>
 #include <sys/types.h>
 
 #include "base/log/ace_trace.h"
 #include "base/log/log.h"
 
 namespace OHOS::Ace {
+namespace {
+// Assets of a module are a few hundred paths, a larger cache means lookups of generated names.
+constexpr size_t MAX_PROBE_CACHE_SIZE = 2048;
+} // namespace
+
+std::atomic<uint32_t> FileAssetProvider::cacheGeneration_ { 0 };
 
 FileAssetProvider::~FileAssetProvider() {}
 
@@ -35,6 +42,7 @@ bool FileAssetProvider::Initialize(const std::string& packagePath, const std::ve
     }
     assetBasePaths_ = assetBasePaths;
     packagePath_ = packagePath;
+    InvalidateCache();
     return true;
 }
 
@@ -72,6 +80,9 @@ std::unique_ptr<AssetMapping> FileAssetProvider::GetAsMapping(const std::string&
 
     for (const auto& basePath : assetBasePaths_) {
         std::string fileName = packagePath_ + basePath + "/" + assetName;
+        if (ProbePath(fileName) == PathKind::MISSING) {
+            continue;
+        }
         std::FILE* fp = std::fopen(fileName.c_str(), "r");
         if (fp == nullptr) {
             continue;
@@ -111,11 +122,9 @@ std::string FileAssetProvider::GetAssetPath(const std::string& assetName, bool)
     for (const auto& basePath : assetBasePaths_) {
         std::string assetBasePath = packagePath_ + basePath;
         std::string fileName = assetBasePath + assetName;
-        std::FILE* fp = std::fopen(fileName.c_str(), "r");
-        if (fp == nullptr) {
+        if (ProbePath(fileName) == PathKind::MISSING) {
             continue;
         }
-        std::fclose(fp);
         return assetBasePath;
     }
     LOGE("Cannot find base path of %{public}s", assetName.c_str());
@@ -127,7 +136,7 @@ void FileAssetProvider::GetAssetList(const std::string& path, std::vector<std::s
     for (const auto& basePath : assetBasePaths_) {
         DIR* dp = nullptr;
         auto openDir = packagePath_ + basePath + path;
-        if (nullptr == (dp = opendir(openDir.c_str()))) {
+        if (ProbePath(openDir) != PathKind::DIRECTORY || nullptr == (dp = opendir(openDir.c_str()))) {
             continue;
         }
         struct dirent* dptr = nullptr;
@@ -142,4 +151,42 @@ void FileAssetProvider::GetAssetList(const std::string& path, std::vector<std::s
     }
 }
 
+void FileAssetProvider::InvalidateCache()
+{
+    std::lock_guard<std::mutex> lock(probeMutex_);
+    probeCache_.clear();
+}
+
+void FileAssetProvider::InvalidateAllCaches()
+{
+    cacheGeneration_.fetch_add(1, std::memory_order_release);
+}
+
+FileAssetProvider::PathKind FileAssetProvider::ProbePath(const std::string& fullPath) const
+{
+    {
+        std::lock_guard<std::mutex> lock(probeMutex_);
+        uint32_t generation = cacheGeneration_.load(std::memory_order_acquire);
+        if (probeGeneration_ != generation) {
+            probeCache_.clear();
+            probeGeneration_ = generation;
+        }
+        auto iter = probeCache_.find(fullPath);
+        if (iter != probeCache_.end()) {
+            return iter->second;
+        }
+    }
+    struct stat pathStat {};
+    PathKind kind = PathKind::MISSING;
+    if (stat(fullPath.c_str(), &pathStat) == 0) {
+        kind = S_ISDIR(pathStat.st_mode) ? PathKind::DIRECTORY : PathKind::FILE;
+    }
+    std::lock_guard<std::mutex> lock(probeMutex_);
+    if (probeCache_.size() >= MAX_PROBE_CACHE_SIZE) {
+        probeCache_.clear();
+    }
+    probeCache_.emplace(fullPath, kind);
+    return kind;
+}
+
 } // namespace OHOS::Ace
@@ -16,7 +16,9 @@
 #ifndef FOUNDATION_ACE_ADAPTER_ANDROID_OSAL_FILE_ASSET_PROVIDER_H
 #define FOUNDATION_ACE_ADAPTER_ANDROID_OSAL_FILE_ASSET_PROVIDER_H
 
+#include <atomic>
 #include <map>
+#include <mutex>
 #include <sstream>
 #include <string>
 #include <unordered_map>
@@ -52,12 +54,30 @@ public:
 
     void GetAssetList(const std::string& path, std::vector<std::string>& assetList) override;
 
+    // Forgets the cached probe results, to be called when files under the base paths are replaced.
+    void InvalidateCache();
+    // Forgets the cached probe results of every provider, for updates that do not know which providers exist.
+    static void InvalidateAllCaches();
+
 private:
+    enum class PathKind : uint8_t {
+        MISSING = 0,
+        FILE,
+        DIRECTORY,
+    };
+
+    // Stats each full path once and caches hits and misses, most lookups miss several base paths first.
+    PathKind ProbePath(const std::string& fullPath) const;
+
     std::unordered_map<std::string, uint64_t> fileMap_;
     mutable std::mutex mutex_;
     std::map<std::string, std::string> filePathMap_;
     std::string packagePath_;
     std::vector<std::string> assetBasePaths_;
+    mutable std::mutex probeMutex_;
+    mutable std::unordered_map<std::string, PathKind> probeCache_;
+    mutable uint32_t probeGeneration_ = 0;
+    static std::atomic<uint32_t> cacheGeneration_;
 };
 
 } // namespace OHOS::Ace
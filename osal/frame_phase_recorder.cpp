@@ -0,0 +1,230 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "adapter/android/osal/frame_phase_recorder.h"
+
+#include <algorithm>
+
+#include "base/utils/time_util.h"
+
+namespace OHOS::Ace {
+namespace {
+constexpr int32_t PERCENT_50 = 50;
+constexpr int32_t PERCENT_90 = 90;
+constexpr int32_t PERCENT_99 = 99;
+constexpr int32_t PERCENT_100 = 100;
+constexpr const char* PHASE_NAMES[] = { "vsync", "animation", "build", "layout", "render", "flush" };
+
+inline size_t ToIndex(FramePhase phase)
+{
+    return static_cast<size_t>(phase);
+}
+
+// The frame currently being recorded on the calling UI thread. Every container runs its own UI thread.
+struct OpenFrame {
+    uint32_t generation = 0;
+    bool open = false;
+    int32_t lastPhase = -1;
+    FrameTiming timing;
+    std::array<int64_t, FRAME_PHASE_COUNT> phaseBegin {};
+};
+
+thread_local OpenFrame g_openFrame;
+
+OpenFrame& GetOpenFrame(uint32_t generation)
+{
+    if (g_openFrame.generation != generation) {
+        g_openFrame.generation = generation;
+        g_openFrame.open = false;
+    }
+    return g_openFrame;
+}
+
+void StartFrame(OpenFrame& frame, int64_t now)
+{
+    frame.timing = FrameTiming();
+    frame.timing.frameStart = now;
+    frame.phaseBegin.fill(0);
+    frame.open = true;
+    frame.lastPhase = static_cast<int32_t>(FramePhase::VSYNC);
+}
+
+const FrameTiming& CloseFrame(OpenFrame& frame, int64_t frameEnd)
+{
+    frame.timing.frameEnd = frameEnd;
+    frame.open = false;
+    return frame.timing;
+}
+
+int64_t GetPercentile(std::vector<int64_t>& samples, int32_t percent)
+{
+    if (samples.empty()) {
+        return 0;
+    }
+    size_t index = (samples.size() - 1) * static_cast<size_t>(percent) / PERCENT_100;
+    std::nth_element(samples.begin(), samples.begin() + index, samples.end());
+    return samples[index];
+}
+} // namespace
+
+FramePhaseRecorder& FramePhaseRecorder::GetInstance()
+{
+    static FramePhaseRecorder instance;
+    return instance;
+}
+
+const char* FramePhaseRecorder::GetPhaseName(FramePhase phase)
+{
+    size_t index = ToIndex(phase);
+    return index < FRAME_PHASE_COUNT ? PHASE_NAMES[index] : "unknown";
+}
+
+void FramePhaseRecorder::BeginFrame()
+{
+    if (!IsEnabled()) {
+        return;
+    }
+    int64_t now = GetSysTimestamp();
+    auto& frame = GetOpenFrame(generation_.load(std::memory_order_relaxed));
+    if (frame.open) {
+        CommitFrame(CloseFrame(frame, now));
+    }
+    StartFrame(frame, now);
+}
+
+void FramePhaseRecorder::EndFrame()
+{
+    if (!IsEnabled()) {
+        return;
+    }
+    auto& frame = GetOpenFrame(generation_.load(std::memory_order_relaxed));
+    if (!frame.open) {
+        return;
+    }
+    CommitFrame(CloseFrame(frame, GetSysTimestamp()));
+}
+
+void FramePhaseRecorder::BeginPhase(FramePhase phase)
+{
+    if (!IsEnabled() || phase >= FramePhase::COUNT) {
+        return;
+    }
+    int64_t now = GetSysTimestamp();
+    auto& frame = GetOpenFrame(generation_.load(std::memory_order_relaxed));
+    auto index = static_cast<int32_t>(phase);
+    // A phase that does not move forward means the previous frame ended without an explicit FlushEnd.
+    if (frame.open && index <= frame.lastPhase) {
+        CommitFrame(CloseFrame(frame, now));
+    }
+    if (!frame.open) {
+        StartFrame(frame, now);
+    }
+    if (frame.lastPhase == static_cast<int32_t>(FramePhase::VSYNC)) {
+        frame.timing.phaseDuration[ToIndex(FramePhase::VSYNC)] = now - frame.timing.frameStart;
+    }
+    frame.phaseBegin[ToIndex(phase)] = now;
+    frame.lastPhase = index;
+}
+
+void FramePhaseRecorder::EndPhase(FramePhase phase)
+{
+    if (!IsEnabled() || phase >= FramePhase::COUNT) {
+        return;
+    }
+    auto& frame = GetOpenFrame(generation_.load(std::memory_order_relaxed));
+    auto& begin = frame.phaseBegin[ToIndex(phase)];
+    if (!frame.open || begin == 0) {
+        return;
+    }
+    frame.timing.phaseDuration[ToIndex(phase)] += GetSysTimestamp() - begin;
+    begin = 0;
+}
+
+void FramePhaseRecorder::NotifyFrameDone()
+{
+    lastFrameEnd_.store(GetSysTimestamp(), std::memory_order_relaxed);
+}
+
+void FramePhaseRecorder::CommitFrame(const FrameTiming& frame)
+{
+    std::vector<FrameTiming> batch;
+    ExportHook hook;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        frames_[writeIndex_] = frame;
+        writeIndex_ = (writeIndex_ + 1) % CAPACITY;
+        ++frameCount_;
+        if (writeIndex_ == 0 && exportHook_) {
+            batch.assign(frames_.begin(), frames_.end());
+            hook = exportHook_;
+        }
+    }
+    if (hook) {
+        hook(batch);
+    }
+}
+
+std::vector<FrameTiming> FramePhaseRecorder::GetFrames() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    std::vector<FrameTiming> frames;
+    if (frameCount_ < CAPACITY) {
+        frames.assign(frames_.begin(), frames_.begin() + frameCount_);
+        return frames;
+    }
+    frames.reserve(CAPACITY);
+    frames.insert(frames.end(), frames_.begin() + writeIndex_, frames_.end());
+    frames.insert(frames.end(), frames_.begin(), frames_.begin() + writeIndex_);
+    return frames;
+}
+
+FramePhasePercentiles FramePhaseRecorder::GetPercentiles() const
+{
+    FramePhasePercentiles result;
+    auto frames = GetFrames();
+    result.sampleCount = frames.size();
+    if (frames.empty()) {
+        return result;
+    }
+
+    std::vector<int64_t> samples(frames.size());
+    for (size_t phase = 0; phase < FRAME_PHASE_COUNT; ++phase) {
+        std::transform(frames.begin(), frames.end(), samples.begin(),
+            [phase](const FrameTiming& frame) { return frame.phaseDuration[phase]; });
+        result.p50[phase] = GetPercentile(samples, PERCENT_50);
+        result.p90[phase] = GetPercentile(samples, PERCENT_90);
+        result.p99[phase] = GetPercentile(samples, PERCENT_99);
+    }
+    std::transform(frames.begin(), frames.end(), samples.begin(),
+        [](const FrameTiming& frame) { return frame.GetTotalDuration(); });
+    result.totalP50 = GetPercentile(samples, PERCENT_50);
+    result.totalP90 = GetPercentile(samples, PERCENT_90);
+    result.totalP99 = GetPercentile(samples, PERCENT_99);
+    return result;
+}
+
+void FramePhaseRecorder::Reset()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    writeIndex_ = 0;
+    frameCount_ = 0;
+}
+
+void FramePhaseRecorder::SetExportHook(ExportHook&& hook)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    exportHook_ = std::move(hook);
+}
+} // namespace OHOS::Ace
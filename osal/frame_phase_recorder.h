@@ -0,0 +1,130 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FOUNDATION_ACE_ADAPTER_ANDROID_OSAL_FRAME_PHASE_RECORDER_H
+#define FOUNDATION_ACE_ADAPTER_ANDROID_OSAL_FRAME_PHASE_RECORDER_H
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace OHOS::Ace {
+enum class FramePhase : uint8_t {
+    VSYNC = 0,
+    ANIMATION,
+    BUILD,
+    LAYOUT,
+    RENDER,
+    FLUSH,
+    COUNT,
+};
+
+constexpr size_t FRAME_PHASE_COUNT = static_cast<size_t>(FramePhase::COUNT);
+
+// Timestamps are monotonic nanoseconds. The VSYNC phase covers the delay between the frame start and the
+// first pipeline phase, the other phases are the time spent between their begin and end hooks.
+struct FrameTiming {
+    int64_t frameStart = 0;
+    int64_t frameEnd = 0;
+    std::array<int64_t, FRAME_PHASE_COUNT> phaseDuration {};
+
+    int64_t GetTotalDuration() const
+    {
+        return frameEnd - frameStart;
+    }
+};
+
+struct FramePhasePercentiles {
+    size_t sampleCount = 0;
+    std::array<int64_t, FRAME_PHASE_COUNT> p50 {};
+    std::array<int64_t, FRAME_PHASE_COUNT> p90 {};
+    std::array<int64_t, FRAME_PHASE_COUNT> p99 {};
+    int64_t totalP50 = 0;
+    int64_t totalP90 = 0;
+    int64_t totalP99 = 0;
+};
+
+// Records the per-phase timing of UI frames into a fixed-size ring buffer. Hooks are driven by FrameReport
+// from the UI threads, each thread keeps its own open frame. Queries may come from any thread.
+class FramePhaseRecorder final {
+public:
+    using ExportHook = std::function<void(const std::vector<FrameTiming>& frames)>;
+
+    static constexpr size_t CAPACITY = 256;
+
+    static FramePhaseRecorder& GetInstance();
+
+    void SetEnabled(bool enabled)
+    {
+        enabled_.store(enabled, std::memory_order_relaxed);
+        // Frames left open on any UI thread are abandoned instead of being committed with a gap.
+        generation_.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    bool IsEnabled() const
+    {
+        return enabled_.load(std::memory_order_relaxed);
+    }
+
+    void BeginFrame();
+    void EndFrame();
+    void BeginPhase(FramePhase phase);
+    void EndPhase(FramePhase phase);
+
+    // Returns the recorded frames, oldest first.
+    std::vector<FrameTiming> GetFrames() const;
+    FramePhasePercentiles GetPercentiles() const;
+    void Reset();
+
+    // Called from the vsync frame callback of the window, which runs whether or not recording is enabled.
+    void NotifyFrameDone();
+
+    // GetSysTimestamp of the end of the last frame, 0 before the first one. Frames only run while something is
+    // animating or dirty, so this doubles as a cheap UI activity signal.
+    int64_t GetLastFrameEnd() const
+    {
+        return lastFrameEnd_.load(std::memory_order_relaxed);
+    }
+
+    // The hook receives every CAPACITY frames as one batch, right before the ring buffer starts overwriting them.
+    void SetExportHook(ExportHook&& hook);
+
+    static const char* GetPhaseName(FramePhase phase);
+
+private:
+    FramePhaseRecorder() = default;
+    ~FramePhaseRecorder() = default;
+    FramePhaseRecorder(const FramePhaseRecorder&) = delete;
+    FramePhaseRecorder& operator=(const FramePhaseRecorder&) = delete;
+
+    void CommitFrame(const FrameTiming& frame);
+
+    // Off in production, switched on with the "-framephase on" dump option.
+    std::atomic<bool> enabled_ { false };
+    std::atomic<uint32_t> generation_ { 0 };
+    std::atomic<int64_t> lastFrameEnd_ { 0 };
+
+    mutable std::mutex mutex_;
+    std::array<FrameTiming, CAPACITY> frames_;
+    size_t writeIndex_ = 0;
+    size_t frameCount_ = 0;
+    ExportHook exportHook_;
+};
+} // namespace OHOS::Ace
+#endif // FOUNDATION_ACE_ADAPTER_ANDROID_OSAL_FRAME_PHASE_RECORDER_H
@@ -15,6 +15,8 @@
 
 #include "base/log/frame_report.h"
 
+#include "adapter/android/osal/frame_phase_recorder.h"
+
 namespace OHOS::Ace {
 
 FrameReport& FrameReport::GetInstance()
@@ -49,57 +51,68 @@ void FrameReport::Init()
 int FrameReport::GetEnable()
 {
     frameGetEnableFunc_ = nullptr;
-    return false;
+    // Gates the engine's calls into the hooks below, which only feed the opt-in frame phase breakdown.
+    return FramePhaseRecorder::GetInstance().IsEnabled();
 }
 
 void FrameReport::BeginFlushAnimation()
 {
     beginFlushAnimationFunc_ = nullptr;
+    FramePhaseRecorder::GetInstance().BeginPhase(FramePhase::ANIMATION);
 }
 
 void FrameReport::EndFlushAnimation()
 {
     endFlushAnimationFunc_ = nullptr;
+    FramePhaseRecorder::GetInstance().EndPhase(FramePhase::ANIMATION);
 }
 
 void FrameReport::BeginFlushBuild()
 {
     beginFlushBuildFunc_ = nullptr;
+    FramePhaseRecorder::GetInstance().BeginPhase(FramePhase::BUILD);
 }
 
 void FrameReport::EndFlushBuild()
 {
     endFlushBuildFunc_ = nullptr;
+    FramePhaseRecorder::GetInstance().EndPhase(FramePhase::BUILD);
 }
 
 void FrameReport::BeginFlushLayout()
 {
     beginFlushLayoutFunc_ = nullptr;
+    FramePhaseRecorder::GetInstance().BeginPhase(FramePhase::LAYOUT);
 }
 
 void FrameReport::EndFlushLayout()
 {
     endFlushLayoutFunc_ = nullptr;
+    FramePhaseRecorder::GetInstance().EndPhase(FramePhase::LAYOUT);
 }
 
 void FrameReport::BeginFlushRender()
 {
     beginFlushRenderFunc_ = nullptr;
+    FramePhaseRecorder::GetInstance().BeginPhase(FramePhase::RENDER);
 }
 
 void FrameReport::EndFlushRender()
 {
     endFlushRenderFunc_ = nullptr;
+    FramePhaseRecorder::GetInstance().EndPhase(FramePhase::RENDER);
 }
 
 void FrameReport::BeginFlushRenderFinish()
 {
     beginFlushRenderFinishFunc_ = nullptr;
+    FramePhaseRecorder::GetInstance().BeginPhase(FramePhase::FLUSH);
 }
 
 void FrameReport::EndFlushRenderFinish()
 {
     endFlushRenderFinishFunc_ = nullptr;
+    FramePhaseRecorder::GetInstance().EndPhase(FramePhase::FLUSH);
 }
 
 void FrameReport::BeginProcessPostFlush()
@@ -120,11 +133,13 @@ void FrameReport::EndListFling()
 void FrameReport::FlushBegin()
 {
     flushBeginFunc_ = nullptr;
+    FramePhaseRecorder::GetInstance().BeginFrame();
 }
 
 void FrameReport::FlushEnd()
 {
     flushEndFunc_ = nullptr;
+    FramePhaseRecorder::GetInstance().EndFrame();
 }
 
 void FrameReport::EnableSelfRender()
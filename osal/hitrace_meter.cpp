@@ -17,9 +17,14 @@
 
 #include <android/api-level.h>
 #include <android/trace.h>
+#include <algorithm>
 #include <atomic>
+#include <cstdarg>
 #include <mutex>
 #include <string>
+#include <string_view>
+#include <unordered_map>
+#include <unordered_set>
 
 #include "hilog/log.h"
 #include "securec.h"
@@ -42,21 +47,104 @@ std::atomic<int32_t> g_androidApiLevel(-1);
 std::once_flag g_onceFlag;
 constexpr int ANDROID_API_29 = 29; // ATrace section APIs are supported starting from Android API level 29
 constexpr int VAR_NAME_MAX_SIZE = 400;
-
-inline std::string FormatTraceName(const std::string& name)
+constexpr char TRACE_NAME_PREFIX[] = "H:";
+constexpr size_t TRACE_NAME_PREFIX_LEN = sizeof(TRACE_NAME_PREFIX) - 1;
+// Names longer than this are usually built from runtime data and are not worth interning.
+constexpr size_t MAX_INTERNED_NAME_LEN = 128;
+constexpr size_t MAX_INTERNED_NAME_COUNT = 2048;
+
+std::mutex g_internMutex;
+// Node based, so the stored strings never move once inserted.
+std::unordered_set<std::string> g_internedNames;
+std::atomic<bool> g_internTableFull(false);
+
+// Returns the prefixed, process-lifetime copy of |name|, or nullptr if it cannot be interned.
+const char* InternTraceName(std::string_view name)
 {
-    return std::string("H:") + name;
-}
+    thread_local std::unordered_map<std::string_view, const char*> localNames;
+    auto iter = localNames.find(name);
+    if (iter != localNames.end()) {
+        return iter->second;
+    }
+    if (name.size() > MAX_INTERNED_NAME_LEN || g_internTableFull.load(std::memory_order_relaxed)) {
+        return nullptr;
+    }
 
-inline std::string FormatTraceName(const char* name)
-{
-    std::string ret("H:");
-    if (name != nullptr && strlen(name) > 0) {
-        ret.append(name);
+    std::string prefixed;
+    prefixed.reserve(TRACE_NAME_PREFIX_LEN + name.size());
+    prefixed.append(TRACE_NAME_PREFIX).append(name);
+    const std::string* interned = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(g_internMutex);
+        auto found = g_internedNames.find(prefixed);
+        if (found == g_internedNames.end()) {
+            if (g_internedNames.size() >= MAX_INTERNED_NAME_COUNT) {
+                g_internTableFull.store(true, std::memory_order_relaxed);
+                return nullptr;
+            }
+            found = g_internedNames.emplace(std::move(prefixed)).first;
+        }
+        interned = &(*found);
     }
-    return ret;
+    std::string_view key(interned->data() + TRACE_NAME_PREFIX_LEN, interned->size() - TRACE_NAME_PREFIX_LEN);
+    localNames.emplace(key, interned->c_str());
+    return interned->c_str();
 }
 
+// Prefixed trace name that is either interned or built on the stack, never on the heap.
+class TraceName final {
+public:
+    explicit TraceName(std::string_view name)
+    {
+        name_ = InternTraceName(name);
+        if (name_ != nullptr) {
+            return;
+        }
+        size_t len = std::min(name.size(), sizeof(buffer_) - TRACE_NAME_PREFIX_LEN - 1);
+        if (memcpy_s(buffer_, sizeof(buffer_), TRACE_NAME_PREFIX, TRACE_NAME_PREFIX_LEN) != EOK ||
+            (len > 0 && memcpy_s(buffer_ + TRACE_NAME_PREFIX_LEN, sizeof(buffer_) - TRACE_NAME_PREFIX_LEN,
+                name.data(), len) != EOK)) {
+            len = 0;
+        }
+        buffer_[TRACE_NAME_PREFIX_LEN + len] = '\0';
+        name_ = buffer_;
+    }
+
+    explicit TraceName(const char* name) : TraceName(name != nullptr ? std::string_view(name) : std::string_view()) {}
+
+    // Formatted names are unique by nature, so they bypass the intern table.
+    TraceName(const char* fmt, va_list args)
+    {
+        name_ = buffer_;
+        buffer_[0] = TRACE_NAME_PREFIX[0];
+        buffer_[1] = TRACE_NAME_PREFIX[1];
+        buffer_[TRACE_NAME_PREFIX_LEN] = '\0';
+        if (fmt == nullptr) {
+            return;
+        }
+        int res = vsnprintf_s(buffer_ + TRACE_NAME_PREFIX_LEN, sizeof(buffer_) - TRACE_NAME_PREFIX_LEN,
+            sizeof(buffer_) - TRACE_NAME_PREFIX_LEN - 1, fmt, args);
+        // Truncation also reports failure but leaves a usable prefix, keep it so begin/end stay balanced.
+        if (res < 0 && buffer_[TRACE_NAME_PREFIX_LEN] == '\0') {
+            HILOG_ERROR(LOG_CORE, "vsnprintf_s failed: %{public}d, name: %{public}s", errno, fmt);
+        }
+    }
+
+    ~TraceName() = default;
+
+    const char* c_str() const
+    {
+        return name_;
+    }
+
+private:
+    TraceName(const TraceName&) = delete;
+    TraceName& operator=(const TraceName&) = delete;
+
+    const char* name_ = nullptr;
+    char buffer_[VAR_NAME_MAX_SIZE];
+};
+
 inline int32_t GetAndroidApiLevel()
 {
     std::call_once(g_onceFlag, []() {
@@ -74,6 +162,27 @@ inline bool IsTraceDisabled(uint64_t tag)
 {
     return !IsTagEnabled(tag);
 }
+
+// Async sections and counters are weak symbols that only exist from API level 29.
+inline bool IsAsyncTraceDisabled(uint64_t tag)
+{
+    return IsTraceDisabled(tag) || (GetAndroidApiLevel() < ANDROID_API_29);
+}
+
+inline void BeginSection(const TraceName& name)
+{
+    ATrace_beginSection(name.c_str());
+}
+
+inline void BeginAsyncSection(const TraceName& name, int32_t taskId)
+{
+    ATrace_beginAsyncSection(name.c_str(), taskId);
+}
+
+inline void EndAsyncSection(const TraceName& name, int32_t taskId)
+{
+    ATrace_endAsyncSection(name.c_str(), taskId);
+}
 }; // namespace
 
 ACE_FORCE_EXPORT void UpdateTraceLabel() {}
@@ -83,24 +192,54 @@ ACE_FORCE_EXPORT void SetTraceDisabled(bool disable) {}
 ACE_FORCE_EXPORT void StartTrace(uint64_t tag, const std::string& name, float limit)
 {
     if (!IsTraceDisabled(tag)) {
-        ATrace_beginSection(FormatTraceName(name).c_str());
+        BeginSection(TraceName(name));
     }
 }
 
 ACE_FORCE_EXPORT void StartTraceEx(HiTraceOutputLevel level, uint64_t tag, const char* name, const char* customArgs)
 {
     if (IsTraceLevelValid(level) && !IsTraceDisabled(tag)) {
-        ATrace_beginSection(FormatTraceName(name).c_str());
+        BeginSection(TraceName(name));
     }
 }
 
-ACE_FORCE_EXPORT void StartTraceDebug(bool isDebug, uint64_t tag, const std::string& name, float limit) {}
+ACE_FORCE_EXPORT void StartTraceDebug(bool isDebug, uint64_t tag, const std::string& name, float limit)
+{
+    if (isDebug && !IsTraceDisabled(tag)) {
+        BeginSection(TraceName(name));
+    }
+}
 
-ACE_FORCE_EXPORT void StartTraceArgs(uint64_t tag, const char* fmt, ...) {}
+ACE_FORCE_EXPORT void StartTraceArgs(uint64_t tag, const char* fmt, ...)
+{
+    if (IsTraceDisabled(tag)) {
+        return;
+    }
+    va_list args;
+    va_start(args, fmt);
+    TraceName name(fmt, args);
+    va_end(args);
+    BeginSection(name);
+}
 
-ACE_FORCE_EXPORT void StartTraceArgsDebug(bool isDebug, uint64_t tag, const char* fmt, ...) {}
+ACE_FORCE_EXPORT void StartTraceArgsDebug(bool isDebug, uint64_t tag, const char* fmt, ...)
+{
+    if (!isDebug || IsTraceDisabled(tag)) {
+        return;
+    }
+    va_list args;
+    va_start(args, fmt);
+    TraceName name(fmt, args);
+    va_end(args);
+    BeginSection(name);
+}
 
-ACE_FORCE_EXPORT void StartTraceWrapper(uint64_t tag, const char* name) {}
+ACE_FORCE_EXPORT void StartTraceWrapper(uint64_t tag, const char* name)
+{
+    if (!IsTraceDisabled(tag)) {
+        BeginSection(TraceName(name));
+    }
+}
 
 ACE_FORCE_EXPORT void FinishTrace(uint64_t tag)
 {
@@ -116,72 +255,148 @@ ACE_FORCE_EXPORT void FinishTraceEx(HiTraceOutputLevel level, uint64_t tag)
     }
 }
 
-ACE_FORCE_EXPORT void FinishTraceDebug(bool isDebug, uint64_t tag) {}
+ACE_FORCE_EXPORT void FinishTraceDebug(bool isDebug, uint64_t tag)
+{
+    if (isDebug && !IsTraceDisabled(tag)) {
+        ATrace_endSection();
+    }
+}
 
 ACE_FORCE_EXPORT void StartAsyncTrace(uint64_t tag, const std::string& name, int32_t taskId, float limit)
 {
-    if (!IsTraceDisabled(tag) && (GetAndroidApiLevel() >= ANDROID_API_29)) {
-        ATrace_beginAsyncSection(FormatTraceName(name).c_str(), taskId);
+    if (!IsAsyncTraceDisabled(tag)) {
+        BeginAsyncSection(TraceName(name), taskId);
     }
 }
 
 ACE_FORCE_EXPORT void StartAsyncTraceEx(HiTraceOutputLevel level, uint64_t tag, const char* name, int32_t taskId,
     const char* customCategory, const char* customArgs)
 {
-    if (IsTraceLevelValid(level) && !IsTraceDisabled(tag) && (GetAndroidApiLevel() >= ANDROID_API_29)) {
-        ATrace_beginAsyncSection(FormatTraceName(name).c_str(), taskId);
+    if (IsTraceLevelValid(level) && !IsAsyncTraceDisabled(tag)) {
+        BeginAsyncSection(TraceName(name), taskId);
     }
 }
 
 ACE_FORCE_EXPORT void StartAsyncTraceDebug(bool isDebug, uint64_t tag, const std::string& name, int32_t taskId,
-    float limit) {}
+    float limit)
+{
+    if (isDebug && !IsAsyncTraceDisabled(tag)) {
+        BeginAsyncSection(TraceName(name), taskId);
+    }
+}
 
-ACE_FORCE_EXPORT void StartAsyncTraceArgs(uint64_t tag, int32_t taskId, const char* fmt, ...) {}
+ACE_FORCE_EXPORT void StartAsyncTraceArgs(uint64_t tag, int32_t taskId, const char* fmt, ...)
+{
+    if (IsAsyncTraceDisabled(tag)) {
+        return;
+    }
+    va_list args;
+    va_start(args, fmt);
+    TraceName name(fmt, args);
+    va_end(args);
+    BeginAsyncSection(name, taskId);
+}
 
-ACE_FORCE_EXPORT void StartAsyncTraceArgsDebug(bool isDebug, uint64_t tag, int32_t taskId, const char* fmt, ...) {}
+ACE_FORCE_EXPORT void StartAsyncTraceArgsDebug(bool isDebug, uint64_t tag, int32_t taskId, const char* fmt, ...)
+{
+    if (!isDebug || IsAsyncTraceDisabled(tag)) {
+        return;
+    }
+    va_list args;
+    va_start(args, fmt);
+    TraceName name(fmt, args);
+    va_end(args);
+    BeginAsyncSection(name, taskId);
+}
 
-ACE_FORCE_EXPORT void StartAsyncTraceWrapper(uint64_t tag, const char* name, int32_t taskId) {}
+ACE_FORCE_EXPORT void StartAsyncTraceWrapper(uint64_t tag, const char* name, int32_t taskId)
+{
+    if (!IsAsyncTraceDisabled(tag)) {
+        BeginAsyncSection(TraceName(name), taskId);
+    }
+}
 
 ACE_FORCE_EXPORT void StartTraceChain(uint64_t tag, const struct HiTraceIdStruct* hiTraceId, const char* name) {}
 
 ACE_FORCE_EXPORT void FinishAsyncTrace(uint64_t tag, const std::string& name, int32_t taskId)
 {
-    if (!IsTraceDisabled(tag) && (GetAndroidApiLevel() >= ANDROID_API_29)) {
-        ATrace_endAsyncSection(FormatTraceName(name).c_str(), taskId);
+    if (!IsAsyncTraceDisabled(tag)) {
+        EndAsyncSection(TraceName(name), taskId);
     }
 }
 
 ACE_FORCE_EXPORT void FinishAsyncTraceEx(HiTraceOutputLevel level, uint64_t tag, const char* name, int32_t taskId)
 {
-    if (IsTraceLevelValid(level) && !IsTraceDisabled(tag) && (GetAndroidApiLevel() >= ANDROID_API_29)) {
-        ATrace_endAsyncSection(FormatTraceName(name).c_str(), taskId);
+    if (IsTraceLevelValid(level) && !IsAsyncTraceDisabled(tag)) {
+        EndAsyncSection(TraceName(name), taskId);
     }
 }
 
-ACE_FORCE_EXPORT void FinishAsyncTraceDebug(bool isDebug, uint64_t tag, const std::string& name, int32_t taskId) {}
+ACE_FORCE_EXPORT void FinishAsyncTraceDebug(bool isDebug, uint64_t tag, const std::string& name, int32_t taskId)
+{
+    if (isDebug && !IsAsyncTraceDisabled(tag)) {
+        EndAsyncSection(TraceName(name), taskId);
+    }
+}
 
-ACE_FORCE_EXPORT void FinishAsyncTraceArgs(uint64_t tag, int32_t taskId, const char* fmt, ...) {}
+ACE_FORCE_EXPORT void FinishAsyncTraceArgs(uint64_t tag, int32_t taskId, const char* fmt, ...)
+{
+    if (IsAsyncTraceDisabled(tag)) {
+        return;
+    }
+    va_list args;
+    va_start(args, fmt);
+    TraceName name(fmt, args);
+    va_end(args);
+    EndAsyncSection(name, taskId);
+}
 
-ACE_FORCE_EXPORT void FinishAsyncTraceArgsDebug(bool isDebug, uint64_t tag, int32_t taskId, const char* fmt, ...) {}
+ACE_FORCE_EXPORT void FinishAsyncTraceArgsDebug(bool isDebug, uint64_t tag, int32_t taskId, const char* fmt, ...)
+{
+    if (!isDebug || IsAsyncTraceDisabled(tag)) {
+        return;
+    }
+    va_list args;
+    va_start(args, fmt);
+    TraceName name(fmt, args);
+    va_end(args);
+    EndAsyncSection(name, taskId);
+}
 
-ACE_FORCE_EXPORT void FinishAsyncTraceWrapper(uint64_t tag, const char* name, int32_t taskId) {}
+ACE_FORCE_EXPORT void FinishAsyncTraceWrapper(uint64_t tag, const char* name, int32_t taskId)
+{
+    if (!IsAsyncTraceDisabled(tag)) {
+        EndAsyncSection(TraceName(name), taskId);
+    }
+}
 
-ACE_FORCE_EXPORT void MiddleTrace(uint64_t tag, const std::string& beforeValue, const std::string& afterValue) {}
+ACE_FORCE_EXPORT void MiddleTrace(uint64_t tag, const std::string& beforeValue, const std::string& afterValue)
+{
+    if (!IsTraceDisabled(tag)) {
+        ATrace_endSection();
+        BeginSection(TraceName(afterValue));
+    }
+}
 
 ACE_FORCE_EXPORT void MiddleTraceDebug(bool isDebug, uint64_t tag, const std::string& beforeValue,
-    const std::string& afterValue) {}
+    const std::string& afterValue)
+{
+    if (isDebug) {
+        MiddleTrace(tag, beforeValue, afterValue);
+    }
+}
 
 ACE_FORCE_EXPORT void CountTrace(uint64_t tag, const std::string& name, int64_t count)
 {
-    if (!IsTraceDisabled(tag) && (GetAndroidApiLevel() >= ANDROID_API_29)) {
-        ATrace_setCounter(FormatTraceName(name).c_str(), count);
+    if (!IsAsyncTraceDisabled(tag)) {
+        ATrace_setCounter(TraceName(name).c_str(), count);
     }
 }
 
 ACE_FORCE_EXPORT void CountTraceEx(HiTraceOutputLevel level, uint64_t tag, const char* name, int64_t count)
 {
-    if (IsTraceLevelValid(level) && !IsTraceDisabled(tag) && (GetAndroidApiLevel() >= ANDROID_API_29)) {
-        ATrace_setCounter(FormatTraceName(name).c_str(), count);
+    if (IsTraceLevelValid(level) && !IsAsyncTraceDisabled(tag)) {
+        ATrace_setCounter(TraceName(name).c_str(), count);
     }
 }
 
@@ -198,9 +413,19 @@ ACE_FORCE_EXPORT int32_t UnregisterTraceListenerNapi(int32_t index)
     return 0;
 }
 
-ACE_FORCE_EXPORT void CountTraceDebug(bool isDebug, uint64_t tag, const std::string& name, int64_t count) {}
+ACE_FORCE_EXPORT void CountTraceDebug(bool isDebug, uint64_t tag, const std::string& name, int64_t count)
+{
+    if (isDebug) {
+        CountTrace(tag, name, count);
+    }
+}
 
-ACE_FORCE_EXPORT void CountTraceWrapper(uint64_t tag, const char* name, int64_t count) {}
+ACE_FORCE_EXPORT void CountTraceWrapper(uint64_t tag, const char* name, int64_t count)
+{
+    if (!IsAsyncTraceDisabled(tag)) {
+        ATrace_setCounter(TraceName(name).c_str(), count);
+    }
+}
 
 ACE_FORCE_EXPORT bool IsTagEnabled(uint64_t tag)
 {
@@ -230,15 +455,9 @@ ACE_FORCE_EXPORT HitraceMeterFmtScoped::HitraceMeterFmtScoped(uint64_t tag, cons
         return;
     }
 
-    char name[VAR_NAME_MAX_SIZE] = { 0 };
     va_list args;
     va_start(args, fmt);
-    int res = vsnprintf_s(name, sizeof(name), sizeof(name) - 1, fmt, args);
+    TraceName name(fmt, args);
     va_end(args);
-    if (res < 0) {
-        HILOG_ERROR(LOG_CORE, "vsnprintf_s failed: %{public}d, name: %{public}s", errno, fmt);
-        return;
-    }
-
-    ATrace_beginSection(FormatTraceName(name).c_str());
+    BeginSection(name);
 }
@@ -0,0 +1,274 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "adapter/android/osal/perf_event_sink.h"
+
+#include <sys/stat.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+
+#include "base/log/log.h"
+#include "base/thread/background_task_executor.h"
+#include "base/utils/time_util.h"
+#include "securec.h"
+
+namespace OHOS::Ace {
+namespace {
+constexpr char FILE_MAGIC[] = { 'A', 'P', 'E', 'S' };
+constexpr uint16_t FILE_VERSION = 1;
+constexpr char CURRENT_FILE_NAME[] = "perf_events.bin";
+constexpr char ROTATED_FILE_FORMAT[] = "perf_events.%d.bin";
+constexpr int32_t MAX_ROTATED_FILES = 2;
+constexpr long MAX_FILE_SIZE = 256 * 1024;
+constexpr size_t MAX_AGGREGATE_KEYS = 512;
+constexpr size_t MAX_NAME_LEN = UINT16_MAX;
+constexpr int64_t FLUSH_INTERVAL_NS = 60LL * 1000 * 1000 * 1000;
+constexpr int32_t ROTATED_NAME_MAX_LEN = 32;
+std::mutex g_fileMutex;
+
+// Records are stored in host byte order, which is little endian on every Android ABI.
+struct FileHeader {
+    char magic[sizeof(FILE_MAGIC)];
+    uint16_t version;
+    uint16_t reserved;
+};
+static_assert(sizeof(FileHeader) == 8, "FileHeader must have no padding");
+
+// Headers are written raw, every byte is an explicit field so nothing uninitialized reaches the file.
+struct RecordHeader {
+    uint8_t type;
+    uint8_t reserved;
+    uint16_t nameLen;
+    int32_t subKey;
+    uint32_t count;
+    uint32_t reserved2;
+    int64_t sum;
+    int64_t max;
+};
+static_assert(sizeof(RecordHeader) == 32, "RecordHeader must have no padding");
+
+int64_t GetWallTimeMs()
+{
+    return std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count();
+}
+
+std::string GetRotatedFilePath(const std::string& dataDir, int32_t index)
+{
+    char name[ROTATED_NAME_MAX_LEN] = { 0 };
+    if (snprintf_s(name, sizeof(name), sizeof(name) - 1, ROTATED_FILE_FORMAT, index) < 0) {
+        return "";
+    }
+    return dataDir + "/" + name;
+}
+
+void AppendRecord(std::vector<uint8_t>& buffer, const PerfEventRecord& record)
+{
+    RecordHeader header {};
+    header.type = static_cast<uint8_t>(record.type);
+    header.nameLen = static_cast<uint16_t>(std::min(record.name.size(), MAX_NAME_LEN));
+    header.subKey = record.subKey;
+    header.count = record.count;
+    header.sum = record.sum;
+    header.max = record.max;
+    auto* begin = reinterpret_cast<const uint8_t*>(&header);
+    buffer.insert(buffer.end(), begin, begin + sizeof(header));
+    buffer.insert(buffer.end(), record.name.begin(), record.name.begin() + header.nameLen);
+}
+} // namespace
+
+PerfEventSink& PerfEventSink::GetInstance()
+{
+    static PerfEventSink instance;
+    return instance;
+}
+
+void PerfEventSink::SetDataDir(const std::string& dataDir)
+{
+    if (mkdir(dataDir.c_str(), S_IRWXU) != 0 && errno != EEXIST) {
+        LOGW("PerfEventSink failed to create %{public}s, errno: %{public}d", dataDir.c_str(), errno);
+        return;
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    dataDir_ = dataDir;
+}
+
+std::string PerfEventSink::GetFilePath() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return dataDir_.empty() ? "" : dataDir_ + "/" + CURRENT_FILE_NAME;
+}
+
+void PerfEventSink::Record(PerfEventType type, const std::string& name, int32_t subKey, int64_t value, uint32_t count)
+{
+    if (count == 0) {
+        return;
+    }
+    int64_t now = GetSysTimestamp();
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (windowBegin_ == 0) {
+        windowBegin_ = GetWallTimeMs();
+        lastFlushTime_ = now;
+    }
+    AggregateKey key(static_cast<uint8_t>(type), name, subKey);
+    auto iter = aggregates_.find(key);
+    if (iter == aggregates_.end()) {
+        if (aggregates_.size() >= MAX_AGGREGATE_KEYS) {
+            ++droppedEvents_;
+            return;
+        }
+        iter = aggregates_.emplace(std::move(key), Aggregate()).first;
+    }
+    auto& aggregate = iter->second;
+    aggregate.max = (aggregate.count == 0) ? value : std::max(aggregate.max, value);
+    aggregate.count += count;
+    aggregate.sum += value;
+
+    if (now - lastFlushTime_ >= FLUSH_INTERVAL_NS) {
+        FlushLocked(now);
+    }
+}
+
+void PerfEventSink::Flush()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    FlushLocked(GetSysTimestamp());
+}
+
+void PerfEventSink::FlushLocked(int64_t now)
+{
+    if (dataDir_.empty() || aggregates_.empty()) {
+        return;
+    }
+    int64_t windowEnd = GetWallTimeMs();
+    std::vector<PerfEventRecord> records;
+    records.reserve(aggregates_.size() + 1);
+    PerfEventRecord batch;
+    batch.type = PerfEventType::BATCH;
+    batch.count = droppedEvents_;
+    batch.sum = windowBegin_;
+    batch.max = windowEnd;
+    records.emplace_back(std::move(batch));
+    for (auto& [key, aggregate] : aggregates_) {
+        PerfEventRecord record;
+        record.type = static_cast<PerfEventType>(std::get<0>(key));
+        record.name = std::get<1>(key);
+        record.subKey = std::get<2>(key);
+        record.count = aggregate.count;
+        record.sum = aggregate.sum;
+        record.max = aggregate.max;
+        records.emplace_back(std::move(record));
+    }
+    aggregates_.clear();
+    droppedEvents_ = 0;
+    windowBegin_ = windowEnd;
+    lastFlushTime_ = now;
+
+    BackgroundTaskExecutor::GetInstance().PostTask(
+        [dataDir = dataDir_, records = std::move(records)]() { WriteRecords(dataDir, records); });
+}
+
+void PerfEventSink::RotateIfNeeded(const std::string& dataDir)
+{
+    std::string current = dataDir + "/" + CURRENT_FILE_NAME;
+    struct stat fileStat {};
+    if (stat(current.c_str(), &fileStat) != 0 || fileStat.st_size < MAX_FILE_SIZE) {
+        return;
+    }
+    std::remove(GetRotatedFilePath(dataDir, MAX_ROTATED_FILES).c_str());
+    for (int32_t index = MAX_ROTATED_FILES - 1; index > 0; --index) {
+        std::rename(GetRotatedFilePath(dataDir, index).c_str(), GetRotatedFilePath(dataDir, index + 1).c_str());
+    }
+    std::rename(current.c_str(), GetRotatedFilePath(dataDir, 1).c_str());
+}
+
+void PerfEventSink::WriteRecords(const std::string& dataDir, const std::vector<PerfEventRecord>& records)
+{
+    std::vector<uint8_t> buffer;
+    for (const auto& record : records) {
+        AppendRecord(buffer, record);
+    }
+
+    std::lock_guard<std::mutex> lock(g_fileMutex);
+    RotateIfNeeded(dataDir);
+    std::string path = dataDir + "/" + CURRENT_FILE_NAME;
+    FILE* file = fopen(path.c_str(), "ab");
+    if (file == nullptr) {
+        LOGW("PerfEventSink failed to open %{public}s, errno: %{public}d", path.c_str(), errno);
+        return;
+    }
+    // The initial position of an append stream is implementation defined, the header check needs the real size.
+    if (fseek(file, 0, SEEK_END) == 0 && ftell(file) == 0) {
+        FileHeader header {};
+        if (memcpy_s(header.magic, sizeof(header.magic), FILE_MAGIC, sizeof(FILE_MAGIC)) != EOK) {
+            fclose(file);
+            return;
+        }
+        header.version = FILE_VERSION;
+        fwrite(&header, sizeof(header), 1, file);
+    }
+    if (fwrite(buffer.data(), 1, buffer.size(), file) != buffer.size()) {
+        LOGW("PerfEventSink failed to write %{public}zu bytes", buffer.size());
+    }
+    fclose(file);
+}
+
+bool PerfEventSink::ReadFile(const std::string& path, std::vector<PerfEventRecord>& records)
+{
+    FILE* file = fopen(path.c_str(), "rb");
+    if (file == nullptr) {
+        return false;
+    }
+    FileHeader fileHeader {};
+    if (fread(&fileHeader, sizeof(fileHeader), 1, file) != 1 ||
+        memcmp(fileHeader.magic, FILE_MAGIC, sizeof(FILE_MAGIC)) != 0 || fileHeader.version != FILE_VERSION) {
+        LOGW("PerfEventSink %{public}s is not a valid event file", path.c_str());
+        fclose(file);
+        return false;
+    }
+    RecordHeader header {};
+    while (fread(&header, sizeof(header), 1, file) == 1) {
+        PerfEventRecord record;
+        record.type = static_cast<PerfEventType>(header.type);
+        record.subKey = header.subKey;
+        record.count = header.count;
+        record.sum = header.sum;
+        record.max = header.max;
+        record.name.resize(header.nameLen);
+        if (header.nameLen > 0 && fread(record.name.data(), 1, header.nameLen, file) != header.nameLen) {
+            // A truncated tail is left by a write interrupted by process death, keep what was complete.
+            break;
+        }
+        records.emplace_back(std::move(record));
+    }
+    fclose(file);
+    return true;
+}
+
+bool PerfEventSink::ReadAll(const std::string& dataDir, std::vector<PerfEventRecord>& records)
+{
+    std::lock_guard<std::mutex> lock(g_fileMutex);
+    bool found = false;
+    for (int32_t index = MAX_ROTATED_FILES; index > 0; --index) {
+        found = ReadFile(GetRotatedFilePath(dataDir, index), records) || found;
+    }
+    found = ReadFile(dataDir + "/" + CURRENT_FILE_NAME, records) || found;
+    return found;
+}
+} // namespace OHOS::Ace
@@ -0,0 +1,95 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FOUNDATION_ACE_ADAPTER_ANDROID_OSAL_PERF_EVENT_SINK_H
+#define FOUNDATION_ACE_ADAPTER_ANDROID_OSAL_PERF_EVENT_SINK_H
+
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <string>
+#include <tuple>
+#include <vector>
+
+namespace OHOS::Ace {
+enum class PerfEventType : uint8_t {
+    // Marks the start of one flushed window, sum and max hold the window begin and end in wall clock ms.
+    BATCH = 0,
+    JANK_FRAME,
+    JANK_DURATION,
+    PAGE_NODE_OVERFLOW,
+    PAGE_DEPTH_OVERFLOW,
+    FUNCTION_TIMEOUT,
+    FRAME_RATE_DURATION,
+    EXCEPTION,
+    STATISTIC_EVENT,
+    PAGE_LOAD_TIMEOUT,
+};
+
+struct PerfEventRecord {
+    PerfEventType type = PerfEventType::BATCH;
+    int32_t subKey = 0;
+    uint32_t count = 0;
+    int64_t sum = 0;
+    int64_t max = 0;
+    std::string name;
+};
+
+// Aggregates EventReport statistics in memory and appends them as compact binary records to a rotating file
+// under the app data directory. Nothing leaves the device.
+class PerfEventSink final {
+public:
+    static PerfEventSink& GetInstance();
+
+    // Events recorded before a directory is set are kept in memory until the first flush after it is.
+    void SetDataDir(const std::string& dataDir);
+    // Records count events whose values add up to value.
+    void Record(PerfEventType type, const std::string& name, int32_t subKey, int64_t value, uint32_t count = 1);
+    // Schedules the aggregated events to be written on a background thread.
+    void Flush();
+
+    std::string GetFilePath() const;
+
+    // Reader API for offline analysis. ReadAll returns the records of the rotated files and the current file,
+    // oldest first.
+    static bool ReadFile(const std::string& path, std::vector<PerfEventRecord>& records);
+    static bool ReadAll(const std::string& dataDir, std::vector<PerfEventRecord>& records);
+
+private:
+    using AggregateKey = std::tuple<uint8_t, std::string, int32_t>;
+    struct Aggregate {
+        uint32_t count = 0;
+        int64_t sum = 0;
+        int64_t max = 0;
+    };
+
+    PerfEventSink() = default;
+    ~PerfEventSink() = default;
+    PerfEventSink(const PerfEventSink&) = delete;
+    PerfEventSink& operator=(const PerfEventSink&) = delete;
+
+    void FlushLocked(int64_t now);
+    static void WriteRecords(const std::string& dataDir, const std::vector<PerfEventRecord>& records);
+    static void RotateIfNeeded(const std::string& dataDir);
+
+    mutable std::mutex mutex_;
+    std::string dataDir_;
+    std::map<AggregateKey, Aggregate> aggregates_;
+    int64_t windowBegin_ = 0;
+    int64_t lastFlushTime_ = 0;
+    uint32_t droppedEvents_ = 0;
+};
+} // namespace OHOS::Ace
+#endif // FOUNDATION_ACE_ADAPTER_ANDROID_OSAL_PERF_EVENT_SINK_H
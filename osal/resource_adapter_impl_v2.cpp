@@ -16,10 +16,13 @@
 #include "adapter/android/osal/resource_adapter_impl_v2.h"
 
 #include <dirent.h>
+#include <sys/stat.h>
+#include <unistd.h>
 
 #include "adapter/android/entrance/java/jni/ace_application_info_impl.h"
 #include "adapter/android/osal/resource_convertor.h"
 #include "adapter/android/osal/resource_theme_style.h"
+#include "adapter/android/osal/theme_snapshot.h"
 #include "adapter/android/stage/uicontent/ace_container_sg.h"
 #include "base/utils/system_properties.h"
 #include "core/common/resource/resource_manager.h"
@@ -70,6 +73,36 @@ bool IsDirExist(const std::string& path)
     return true;
 }
 
+// Covers every field GetOverrideResConfig carries, the density scale is kept exact.
+std::string GetOverrideConfigKey(const Global::Resource::ResConfig& resConfig)
+{
+    auto localeInfo = resConfig.GetLocaleInfo();
+    return std::string((localeInfo != nullptr && localeInfo->getName() != nullptr) ? localeInfo->getName() : "") +
+           ";" + std::to_string(static_cast<int32_t>(resConfig.GetColorMode())) + "." +
+           std::to_string(static_cast<int32_t>(resConfig.GetDirection())) + "." +
+           std::to_string(resConfig.GetScreenDensity()) + "." +
+           std::to_string(static_cast<int32_t>(resConfig.GetDeviceType())) + "." +
+           std::to_string(static_cast<int32_t>(resConfig.GetInputDevice()));
+}
+
+// Appends the path of a resources.index to source and its size and mtime to stamp, an app update or a new engine
+// replaces the file.
+void AppendIndexStamp(std::string& source, std::string& stamp, const std::string& indexPath)
+{
+    source.append(indexPath).append(";");
+    struct stat fileStat {};
+    if (stat(indexPath.c_str(), &fileStat) != 0) {
+        stamp.append("-;");
+        return;
+    }
+    stamp.append(std::to_string(fileStat.st_size))
+        .append(".")
+        .append(std::to_string(fileStat.st_mtim.tv_sec))
+        .append(".")
+        .append(std::to_string(fileStat.st_mtim.tv_nsec))
+        .append(";");
+}
+
 DimensionUnit ParseDimensionUnit(const std::string& unit)
 {
     if (unit == "px") {
@@ -139,6 +172,8 @@ void ResourceAdapterImplV2::Init(const ResourceInfo& resourceInfo)
     std::string sysResIndexPath = packagePath + DELIMITER + "systemres" + DELIMITER + "resources.index";
     auto resConfig = ConvertConfigToGlobal(resourceInfo.GetResourceConfiguration());
     CHECK_NULL_VOID(resConfig);
+    resourceSource_.clear();
+    resourceStamp_.clear();
     auto hapPath = resourceInfo.GetHapPath();
     if (hapPath.empty()) {
         LOGI("sysResIndexPath: %s", sysResIndexPath.c_str());
@@ -151,6 +186,7 @@ void ResourceAdapterImplV2::Init(const ResourceInfo& resourceInfo)
             sysResRet, configRet, resConfig->GetDirection(), resConfig->GetScreenDensity(), resConfig->GetDeviceType(),
             resConfig->GetColorMode());
         resourceManager_ = newResMgr;
+        AppendIndexStamp(resourceSource_, resourceStamp_, sysResIndexPath);
     } else {
         std::istringstream iss(hapPath);
         std::string token;
@@ -170,7 +206,9 @@ void ResourceAdapterImplV2::Init(const ResourceInfo& resourceInfo)
                  "ori=%{public}d, dpi=%{public}d, device=%{public}d, colorMode=%{public}d,",
                 appResRet, sysResRet, configRet, resConfig->GetDirection(), resConfig->GetScreenDensity(),
                 resConfig->GetDeviceType(), resConfig->GetColorMode());
+            AppendIndexStamp(resourceSource_, resourceStamp_, appResIndexPath);
         }
+        AppendIndexStamp(resourceSource_, resourceStamp_, sysResIndexPath);
     }
 }
 
@@ -186,6 +224,9 @@ void ResourceAdapterImplV2::UpdateConfig(const ResourceConfiguration& config, bo
         resConfig->GetDirection(), resConfig->GetScreenDensity(), resConfig->GetDeviceType(), resConfig->GetColorMode(),
         resConfig->GetInputDevice());
     resourceManager_->UpdateResConfig(*resConfig, themeFlag);
+    // Override adapters were derived from the previous config.
+    std::lock_guard<std::mutex> overrideLock(overrideMutex_);
+    overrideAdapters_.clear();
 }
 
 ColorMode ResourceAdapterImplV2::GetResourceColorMode() const
@@ -204,6 +245,11 @@ RefPtr<ThemeStyle> ResourceAdapterImplV2::GetTheme(int32_t themeId)
     CHECK_NULL_RETURN(resourceManager_, nullptr);
     CheckThemeId(themeId);
     auto theme = AceType::MakeRefPtr<ResourceThemeStyle>(AceType::Claim(this));
+    auto snapshotKey = GetThemeSnapshotKey(themeId);
+    if (ThemeSnapshot::GetInstance().Load(snapshotKey, theme)) {
+        LOGI("theme themeId=%{public}d loaded from snapshot", themeId);
+        return theme;
+    }
     auto ret = resourceManager_->GetThemeById(themeId, theme->rawAttrs_);
 
     LOGI("theme themeId=%{public}d, ret=%{public}d, attr size=%{public}zu", themeId, ret, theme->rawAttrs_.size());
@@ -248,9 +294,33 @@ RefPtr<ThemeStyle> ResourceAdapterImplV2::GetTheme(int32_t themeId)
         }
     }
 
+    ThemeSnapshot::GetInstance().Store(snapshotKey, theme);
     return theme;
 }
 
+ThemeSnapshotKey ResourceAdapterImplV2::GetThemeSnapshotKey(int32_t themeId) const
+{
+    ThemeSnapshotKey key;
+    // An adapter sharing the resource manager of an ability context does not know its index files.
+    if (resourceSource_.empty()) {
+        return key;
+    }
+    std::unique_ptr<Global::Resource::ResConfig> resConfig(Global::Resource::CreateResConfig());
+    CHECK_NULL_RETURN(resConfig, key);
+    resourceManager_->GetResConfig(*resConfig);
+    auto& appInfo = AceApplicationInfo::GetInstance();
+    key.source = resourceSource_;
+    key.stamp = resourceStamp_;
+    // The density is a scale such as 2.625, it is kept exact since resources are matched against its dpi.
+    key.config = std::to_string(themeId) + ";" + appInfo.GetLanguage() + "-" + appInfo.GetScript() + "-" +
+                 appInfo.GetCountryOrRegion() + ";" + std::to_string(static_cast<int32_t>(resConfig->GetDirection())) +
+                 "." + std::to_string(resConfig->GetScreenDensity()) + "." +
+                 std::to_string(static_cast<int32_t>(resConfig->GetDeviceType())) + "." +
+                 std::to_string(static_cast<int32_t>(resConfig->GetColorMode())) + "." +
+                 std::to_string(static_cast<int32_t>(resConfig->GetInputDevice()));
+    return key;
+}
+
 Color ResourceAdapterImplV2::GetColor(uint32_t resId)
 {
     uint32_t result = 0;
@@ -634,6 +704,71 @@ bool ResourceAdapterImplV2::GetMediaData(const std::string& resName, size_t& len
     return true;
 }
 
+std::shared_ptr<const ResourceDataView> ResourceAdapterImplV2::GetRawFileView(const std::string& rawFile) const
+{
+    std::shared_lock<std::shared_mutex> lock(resourceMutex_);
+    CHECK_NULL_RETURN(resourceManager_, nullptr);
+    OHOS::Global::Resource::ResourceManager::RawFileDescriptor descriptor;
+    if (resourceManager_->GetRawFdNdkFromHap(rawFile, descriptor) == Global::Resource::SUCCESS) {
+        auto view = ResourceDataView::CreateFromFd(descriptor.fd, descriptor.offset, descriptor.length);
+        close(descriptor.fd);
+        if (view) {
+            return view;
+        }
+    }
+    // Compressed entries have no descriptor, the view then owns the inflated buffer.
+    size_t len = 0;
+    std::unique_ptr<uint8_t[]> dest;
+    auto state = resourceManager_->GetRawFileFromHap(rawFile, len, dest);
+    if (state != Global::Resource::SUCCESS || !dest) {
+        LOGE("GetRawFileView error, raw filename:%{public}s, error:%{public}u", rawFile.c_str(), state);
+        return nullptr;
+    }
+    return ResourceDataView::CreateFromBuffer(std::move(dest), len);
+}
+
+std::shared_ptr<const ResourceDataView> ResourceAdapterImplV2::GetMediaView(uint32_t resId) const
+{
+    std::shared_lock<std::shared_mutex> lock(resourceMutex_);
+    CHECK_NULL_RETURN(resourceManager_, nullptr);
+    std::string mediaPath;
+    if (resourceManager_->GetMediaById(resId, mediaPath) == Global::Resource::SUCCESS) {
+        auto view = ResourceDataView::CreateFromFile(mediaPath);
+        if (view) {
+            return view;
+        }
+    }
+    size_t len = 0;
+    std::unique_ptr<uint8_t[]> dest;
+    auto state = resourceManager_->GetMediaDataById(resId, len, dest);
+    if (state != Global::Resource::SUCCESS) {
+        LOGW("GetMediaView error, id=%{public}u, error:%{public}u", resId, state);
+        return nullptr;
+    }
+    return ResourceDataView::CreateFromBuffer(std::move(dest), len);
+}
+
+std::shared_ptr<const ResourceDataView> ResourceAdapterImplV2::GetMediaView(const std::string& resName) const
+{
+    std::shared_lock<std::shared_mutex> lock(resourceMutex_);
+    CHECK_NULL_RETURN(resourceManager_, nullptr);
+    std::string mediaPath;
+    if (resourceManager_->GetMediaByName(resName.c_str(), mediaPath) == Global::Resource::SUCCESS) {
+        auto view = ResourceDataView::CreateFromFile(mediaPath);
+        if (view) {
+            return view;
+        }
+    }
+    size_t len = 0;
+    std::unique_ptr<uint8_t[]> dest;
+    auto state = resourceManager_->GetMediaDataByName(resName.c_str(), len, dest);
+    if (state != Global::Resource::SUCCESS) {
+        LOGE("GetMediaView error, res=%{public}s, error:%{public}u", resName.c_str(), state);
+        return nullptr;
+    }
+    return ResourceDataView::CreateFromBuffer(std::move(dest), len);
+}
+
 bool ResourceAdapterImplV2::GetRawFileDescription(
     const std::string& rawfileName, RawfileDescription& rawfileDescription) const
 {
@@ -741,8 +876,23 @@ RefPtr<ResourceAdapter> ResourceAdapterImplV2::GetOverrideResourceAdapter(
     if (configurationChange.dpiUpdate) {
         overrideResConfig->SetScreenDensity(config.GetDensity());
     }
+    auto key = GetOverrideConfigKey(*overrideResConfig);
+    std::lock_guard<std::mutex> overrideLock(overrideMutex_);
+    auto iter = overrideAdapters_.find(key);
+    if (iter != overrideAdapters_.end()) {
+        auto overrideAdapter = iter->second.Upgrade();
+        if (overrideAdapter) {
+            return overrideAdapter;
+        }
+    }
+    // Drops the adapters no component holds any more before adding one.
+    for (auto it = overrideAdapters_.begin(); it != overrideAdapters_.end();) {
+        it = it->second.Invalid() ? overrideAdapters_.erase(it) : std::next(it);
+    }
     auto overrideResMgr = resourceManager_->GetOverrideResourceManager(overrideResConfig);
-    return AceType::MakeRefPtr<ResourceAdapterImplV2>(overrideResMgr);
+    RefPtr<ResourceAdapter> overrideAdapter = AceType::MakeRefPtr<ResourceAdapterImplV2>(overrideResMgr);
+    overrideAdapters_[key] = AceType::WeakClaim(AceType::RawPtr(overrideAdapter));
+    return overrideAdapter;
 }
 
 uint32_t ResourceAdapterImplV2::GetResId(const std::string& resTypeName) const
@@ -758,6 +908,122 @@ uint32_t ResourceAdapterImplV2::GetResId(const std::string& resTypeName) const
     return resId;
 }
 
+std::vector<ResourceResult> ResourceAdapterImplV2::GetResources(const std::vector<ResourceRequest>& requests) const
+{
+    std::vector<ResourceResult> results(requests.size());
+    std::vector<std::string> actualResNames(requests.size());
+    for (size_t index = 0; index < requests.size(); ++index) {
+        if (!requests[index].resName.empty()) {
+            actualResNames[index] = GetActualResourceName(requests[index].resName);
+        }
+    }
+    size_t failedCount = 0;
+    {
+        std::shared_lock<std::shared_mutex> lock(resourceMutex_);
+        CHECK_NULL_RETURN(resourceManager_, results);
+        for (size_t index = 0; index < requests.size(); ++index) {
+            results[index] = ResolveResource(requests[index], actualResNames[index]);
+            if (!results[index].IsValid()) {
+                ++failedCount;
+            }
+        }
+    }
+    if (failedCount > 0) {
+        LOGW("GetResources error, %{public}zu of %{public}zu lookups failed", failedCount, requests.size());
+    }
+    return results;
+}
+
+ResourceResult ResourceAdapterImplV2::ResolveResource(
+    const ResourceRequest& request, const std::string& actualResName) const
+{
+    bool byName = !request.resName.empty();
+    if (byName && actualResName.empty()) {
+        return {};
+    }
+    const char* name = actualResName.c_str();
+    auto resId = request.resId;
+    ResourceResult result;
+    switch (request.type) {
+        case ResourceRequest::Type::COLOR: {
+            uint32_t color = 0;
+            auto state = byName ? resourceManager_->GetColorByName(name, color)
+                                : resourceManager_->GetColorById(resId, color);
+            if (state == Global::Resource::SUCCESS) {
+                result.value = Color(color);
+            }
+            break;
+        }
+        case ResourceRequest::Type::DIMENSION: {
+            float dimensionFloat = 0.0f;
+            std::string unit;
+            auto state = byName ? resourceManager_->GetFloatByName(name, dimensionFloat, unit)
+                                : resourceManager_->GetFloatById(resId, dimensionFloat, unit);
+            if (state == Global::Resource::SUCCESS) {
+                result.value = Dimension(static_cast<double>(dimensionFloat), ParseDimensionUnit(unit));
+            }
+            break;
+        }
+        case ResourceRequest::Type::STRING: {
+            std::string strResult;
+            auto state = byName ? resourceManager_->GetStringByName(name, strResult)
+                                : resourceManager_->GetStringById(resId, strResult);
+            if (state == Global::Resource::SUCCESS) {
+                result.value = std::move(strResult);
+            }
+            break;
+        }
+        case ResourceRequest::Type::DOUBLE: {
+            float doubleResult = 0.0f;
+            auto state = byName ? resourceManager_->GetFloatByName(name, doubleResult)
+                                : resourceManager_->GetFloatById(resId, doubleResult);
+            if (state == Global::Resource::SUCCESS) {
+                result.value = static_cast<double>(doubleResult);
+            }
+            break;
+        }
+        case ResourceRequest::Type::INT: {
+            int32_t intResult = 0;
+            auto state = byName ? resourceManager_->GetIntegerByName(name, intResult)
+                                : resourceManager_->GetIntegerById(resId, intResult);
+            if (state == Global::Resource::SUCCESS) {
+                result.value = intResult;
+            }
+            break;
+        }
+        case ResourceRequest::Type::BOOLEAN: {
+            bool boolResult = false;
+            auto state = byName ? resourceManager_->GetBooleanByName(name, boolResult)
+                                : resourceManager_->GetBooleanById(resId, boolResult);
+            if (state == Global::Resource::SUCCESS) {
+                result.value = boolResult;
+            }
+            break;
+        }
+        case ResourceRequest::Type::MEDIA_PATH: {
+            std::string mediaPath;
+            auto state = byName ? resourceManager_->GetMediaByName(name, mediaPath)
+                                : resourceManager_->GetMediaById(resId, mediaPath);
+            if (state == Global::Resource::SUCCESS) {
+                result.value = "file:///" + mediaPath;
+            }
+            break;
+        }
+        case ResourceRequest::Type::SYMBOL: {
+            uint32_t symbol = 0;
+            auto state = byName ? resourceManager_->GetSymbolByName(name, symbol)
+                                : resourceManager_->GetSymbolById(resId, symbol);
+            if (state == Global::Resource::SUCCESS) {
+                result.value = symbol;
+            }
+            break;
+        }
+        default:
+            break;
+    }
+    return result;
+}
+
 std::string ResourceAdapterImplV2::GetActualResourceName(const std::string& resName) const
 {
     auto index = resName.find_last_of('.');
@@ -18,11 +18,45 @@
 
 #include <mutex>
 #include <shared_mutex>
+#include <unordered_map>
+#include <variant>
+#include <vector>
 
+#include "adapter/android/osal/resource_data_view.h"
+#include "adapter/android/osal/theme_snapshot.h"
 #include "core/components/theme/resource_adapter.h"
 #include "resource_manager.h"
 
 namespace OHOS::Ace {
+// One lookup of ResourceAdapterImplV2::GetResources, by resName when it is set and by resId otherwise.
+struct ResourceRequest {
+    enum class Type : uint8_t {
+        COLOR = 0,
+        DIMENSION,
+        STRING,
+        DOUBLE,
+        INT,
+        BOOLEAN,
+        MEDIA_PATH,
+        SYMBOL,
+    };
+
+    Type type = Type::STRING;
+    uint32_t resId = 0;
+    std::string resName;
+};
+
+// Holds the alternative of the request type, Dimension for DIMENSION, std::string for STRING and MEDIA_PATH,
+// uint32_t for SYMBOL. A failed lookup keeps std::monostate.
+struct ResourceResult {
+    std::variant<std::monostate, Color, Dimension, std::string, double, int32_t, bool, uint32_t> value;
+
+    bool IsValid() const
+    {
+        return !std::holds_alternative<std::monostate>(value);
+    }
+};
+
 class ResourceAdapterImplV2 : public ResourceAdapter {
     DECLARE_ACE_TYPE(ResourceAdapterImplV2, ResourceAdapter);
 
@@ -79,10 +113,33 @@ public:
         const ResourceConfiguration& config, const ConfigurationChange& configurationChange) override;
     uint32_t GetResId(const std::string& resTypeName) const override;
 
+    // The calls below are not on the engine ResourceAdapter interface yet, the engine reaches them once it declares
+    // them in resource_adapter.h.
+    //
+    // Resolves every request under one acquisition of the resource lock, results are in request order. Used by the
+    // -resource dump of AceViewSG; the engine resource wrapper keeps the per-call lookups until it batches them.
+    std::vector<ResourceResult> GetResources(const std::vector<ResourceRequest>& requests) const;
+    // Shared alternatives of GetRawFileData and GetMediaData, the bytes are mapped instead of copied when the
+    // entry is stored uncompressed. Used by the rawfile and mediadata entries of the -resource dump; the engine
+    // image loaders keep the copying calls until they switch over.
+    std::shared_ptr<const ResourceDataView> GetRawFileView(const std::string& rawFile) const;
+    std::shared_ptr<const ResourceDataView> GetMediaView(uint32_t resId) const;
+    std::shared_ptr<const ResourceDataView> GetMediaView(const std::string& resName) const;
+
 private:
     std::string GetActualResourceName(const std::string& resName) const;
+    // Identifies the parsed theme for ThemeSnapshot, invalid when the resource files are unknown.
+    ThemeSnapshotKey GetThemeSnapshotKey(int32_t themeId) const;
+    // Called with resourceMutex_ held.
+    ResourceResult ResolveResource(const ResourceRequest& request, const std::string& actualResName) const;
 
     std::shared_ptr<Global::Resource::ResourceManager> resourceManager_;
+    // Paths and size and mtime of the resources.index files added in Init.
+    std::string resourceSource_;
+    std::string resourceStamp_;
+    // Override adapters by their override config, shared while some component still holds them.
+    std::mutex overrideMutex_;
+    std::unordered_map<std::string, WeakPtr<ResourceAdapter>> overrideAdapters_;
     mutable std::shared_mutex resourceMutex_;
     ACE_DISALLOW_COPY_AND_MOVE(ResourceAdapterImplV2);
     ColorMode GetResourceColorMode() const override;
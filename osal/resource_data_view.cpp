@@ -0,0 +1,85 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "adapter/android/osal/resource_data_view.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cerrno>
+
+#include "base/log/log.h"
+
+namespace OHOS::Ace {
+ResourceDataView::~ResourceDataView()
+{
+    if (mapAddress_ != nullptr) {
+        munmap(mapAddress_, mapSize_);
+    }
+}
+
+std::shared_ptr<const ResourceDataView> ResourceDataView::CreateFromFd(int fd, int64_t offset, int64_t length)
+{
+    if (fd < 0 || offset < 0 || length <= 0) {
+        return nullptr;
+    }
+    static const int64_t pageSize = sysconf(_SC_PAGESIZE);
+    // mmap takes a page aligned offset, entries stored in a HAP start anywhere.
+    int64_t mapOffset = offset - offset % pageSize;
+    auto delta = static_cast<size_t>(offset - mapOffset);
+    auto mapSize = static_cast<size_t>(length) + delta;
+    void* address = mmap(nullptr, mapSize, PROT_READ, MAP_PRIVATE, fd, static_cast<off_t>(mapOffset));
+    if (address == MAP_FAILED) {
+        LOGW("Map resource data failed, errno: %{public}d", errno);
+        return nullptr;
+    }
+    std::shared_ptr<ResourceDataView> view(new ResourceDataView());
+    view->mapAddress_ = address;
+    view->mapSize_ = mapSize;
+    view->data_ = static_cast<const uint8_t*>(address) + delta;
+    view->size_ = static_cast<size_t>(length);
+    return view;
+}
+
+std::shared_ptr<const ResourceDataView> ResourceDataView::CreateFromFile(const std::string& path)
+{
+    int fd = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        return nullptr;
+    }
+    struct stat fileStat {};
+    std::shared_ptr<const ResourceDataView> view;
+    if (fstat(fd, &fileStat) == 0 && S_ISREG(fileStat.st_mode)) {
+        view = CreateFromFd(fd, 0, fileStat.st_size);
+    }
+    close(fd);
+    return view;
+}
+
+std::shared_ptr<const ResourceDataView> ResourceDataView::CreateFromBuffer(
+    std::unique_ptr<uint8_t[]> buffer, size_t size)
+{
+    if (!buffer || size == 0) {
+        return nullptr;
+    }
+    std::shared_ptr<ResourceDataView> view(new ResourceDataView());
+    view->data_ = buffer.get();
+    view->size_ = size;
+    view->buffer_ = std::move(buffer);
+    return view;
+}
+} // namespace OHOS::Ace
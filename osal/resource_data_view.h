@@ -0,0 +1,64 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FOUNDATION_ACE_ADAPTER_ANDROID_OSAL_RESOURCE_DATA_VIEW_H
+#define FOUNDATION_ACE_ADAPTER_ANDROID_OSAL_RESOURCE_DATA_VIEW_H
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+namespace OHOS::Ace {
+// Read-only bytes of a media or raw file resource, shared by reference counting. The bytes are mapped from the
+// HAP or the extracted file when possible, otherwise the view owns the buffer the resource manager filled.
+class ResourceDataView final {
+public:
+    ~ResourceDataView();
+
+    // Maps length bytes at offset of fd, the caller keeps ownership of fd.
+    static std::shared_ptr<const ResourceDataView> CreateFromFd(int fd, int64_t offset, int64_t length);
+    static std::shared_ptr<const ResourceDataView> CreateFromFile(const std::string& path);
+    static std::shared_ptr<const ResourceDataView> CreateFromBuffer(std::unique_ptr<uint8_t[]> buffer, size_t size);
+
+    const uint8_t* GetData() const
+    {
+        return data_;
+    }
+
+    size_t GetSize() const
+    {
+        return size_;
+    }
+
+    bool IsMapped() const
+    {
+        return mapAddress_ != nullptr;
+    }
+
+private:
+    ResourceDataView() = default;
+    ResourceDataView(const ResourceDataView&) = delete;
+    ResourceDataView& operator=(const ResourceDataView&) = delete;
+
+    const uint8_t* data_ = nullptr;
+    size_t size_ = 0;
+    // The mapping starts at the page containing data_.
+    void* mapAddress_ = nullptr;
+    size_t mapSize_ = 0;
+    std::unique_ptr<uint8_t[]> buffer_;
+};
+} // namespace OHOS::Ace
+#endif // FOUNDATION_ACE_ADAPTER_ANDROID_OSAL_RESOURCE_DATA_VIEW_H
@@ -28,6 +28,8 @@ class ResourceThemeStyle : public ThemeStyle {
 public:
     friend class ResourceAdapterImpl;
     friend class ResourceAdapterImplV2;
+    friend class ThemeSnapshot;
+    friend class ThemeSnapshotCodec;
     using RawAttrMap = std::map<std::string, std::string>;
     using RawPatternMap = std::map<std::string, RawAttrMap>;
 
@@ -15,11 +15,50 @@
 
 #include "base/ressched/ressched_report.h"
 
+#include "adapter/android/osal/thread_sched_policy.h"
+
 namespace OHOS::Ace {
+namespace {
+constexpr uint32_t RES_TYPE_CLICK_RECOGNIZE = 9;
+constexpr uint32_t RES_TYPE_PUSH_PAGE = 10;
+constexpr uint32_t RES_TYPE_SLIDE = 11;
+constexpr uint32_t RES_TYPE_POP_PAGE = 28;
+constexpr uint32_t RES_TYPE_LOAD_PAGE = 34;
+constexpr int64_t TOUCH_DOWN_EVENT = 1;
+constexpr int64_t PAGE_START_EVENT = 0;
+constexpr int64_t SLIDE_DETECTING = 2;
+
+// There is no resource schedule service on Android, scheduling hints are mapped onto local thread boosts.
+void ReportDataToSchedPolicy(uint32_t resType, int64_t value, const std::unordered_map<std::string, std::string>&)
+{
+    auto& policy = ThreadSchedPolicy::GetInstance();
+    switch (resType) {
+        case RES_TYPE_CLICK_RECOGNIZE:
+            if (value == TOUCH_DOWN_EVENT) {
+                policy.Boost(BoostScene::TOUCH_DOWN);
+            }
+            break;
+        case RES_TYPE_PUSH_PAGE:
+        case RES_TYPE_POP_PAGE:
+        case RES_TYPE_LOAD_PAGE:
+            if (value == PAGE_START_EVENT) {
+                policy.Boost(BoostScene::PAGE_TRANSITION);
+            }
+            break;
+        case RES_TYPE_SLIDE:
+            if (value == SLIDE_DETECTING) {
+                policy.Boost(BoostScene::SLIDE);
+            }
+            break;
+        default:
+            break;
+    }
+}
+} // namespace
 
 ReportDataFunc LoadReportDataFunc()
 {
-    return nullptr;
+    return ReportDataToSchedPolicy;
 }
 
 ReportSyncEventFunc LoadReportSyncEventFunc()
@@ -13,12 +13,27 @@
  * limitations under the License.
  */
 
-#include "adapter/preview/osal/socperf_client_impl.h"
+#include "adapter/android/osal/socperf_client_impl.h"
+
+#include "adapter/android/osal/thread_sched_policy.h"
 
 namespace OHOS::Ace {
 SocPerfClient& SocPerfClient::GetInstance()
 {
-    static SocPerfClient instace;
+    static SocPerfClientImpl instace;
     return instace;
 }
+
+// SocPerf commands have no platform counterpart on Android, every request becomes a short thread boost.
+void SocPerfClientImpl::PerfRequest(int32_t cmdId, const std::string& msg)
+{
+    ThreadSchedPolicy::GetInstance().Boost(BoostScene::FLUSH_DIRTY_NODE);
+}
+
+void SocPerfClientImpl::PerfRequestEx(int32_t cmdId, bool onOffTag, const std::string& msg)
+{
+    if (onOffTag) {
+        ThreadSchedPolicy::GetInstance().Boost(BoostScene::FLUSH_DIRTY_NODE);
+    }
+}
 } // namespace OHOS::Ace
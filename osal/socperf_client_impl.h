@@ -13,8 +13,10 @@
  * limitations under the License.
  */
 
-#ifndef FOUNDATION_ACE_ADAPTER_PREVIEW_OSAL_SOCPERF_CLIENT_IMPL_H
-#define FOUNDATION_ACE_ADAPTER_PREVIEW_OSAL_SOCPERF_CLIENT_IMPL_H
+#ifndef FOUNDATION_ACE_ADAPTER_ANDROID_OSAL_SOCPERF_CLIENT_IMPL_H
+#define FOUNDATION_ACE_ADAPTER_ANDROID_OSAL_SOCPERF_CLIENT_IMPL_H
+
+#include <string>
 
 #include "base/perf/socperf_client.h"
 
@@ -23,7 +25,10 @@ class SocPerfClientImpl : public SocPerfClient {
 public:
     SocPerfClientImpl() = default;
     ~SocPerfClientImpl() override = default;
+
+    void PerfRequest(int32_t cmdId, const std::string& msg) override;
+    void PerfRequestEx(int32_t cmdId, bool onOffTag, const std::string& msg) override;
 };
 } // namespace OHOS::Ace
 
-#endif // FOUNDATION_ACE_ADAPTER_PREVIEW_OSAL_SOCPERF_CLIENT_IMPL_H
+#endif // FOUNDATION_ACE_ADAPTER_ANDROID_OSAL_SOCPERF_CLIENT_IMPL_H
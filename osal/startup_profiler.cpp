@@ -0,0 +1,176 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "adapter/android/osal/startup_profiler.h"
+
+#include "base/log/log.h"
+#include "base/utils/time_util.h"
+
+namespace OHOS::Ace {
+namespace {
+constexpr int64_t NANOS_PER_MICRO = 1000;
+constexpr int64_t FIRST_FRAME_TIMEOUT = 10000000000; // 10s in ns
+constexpr const char* PHASE_NAMES[] = { "JniOnLoad", "ClassRegistration", "HapPath", "ModulePreload", "ModuleLoad",
+    "AssetProviderInit", "ContainerInit", "ResourceInit", "ViewAttach", "RunPage", "FirstLayout", "FirstFrame" };
+static_assert(sizeof(PHASE_NAMES) / sizeof(PHASE_NAMES[0]) == static_cast<size_t>(StartupPhase::COUNT),
+    "every startup phase needs a name");
+
+int64_t ToMicros(int64_t nanos)
+{
+    return nanos < 0 ? -1 : nanos / NANOS_PER_MICRO;
+}
+} // namespace
+
+StartupProfiler& StartupProfiler::GetInstance()
+{
+    static StartupProfiler instance;
+    return instance;
+}
+
+const char* StartupProfiler::GetPhaseName(StartupPhase phase)
+{
+    return phase < StartupPhase::COUNT ? PHASE_NAMES[static_cast<size_t>(phase)] : "Unknown";
+}
+
+int64_t StartupProfiler::GetOffsetLocked(int64_t now)
+{
+    if (origin_ == 0) {
+        origin_ = now;
+    }
+    return now - origin_;
+}
+
+bool StartupProfiler::FinishIfOverdue(int64_t now)
+{
+    int64_t deadline = firstFrameDeadline_.load(std::memory_order_relaxed);
+    if (deadline == 0 || now < deadline) {
+        return false;
+    }
+    LOGW("No first frame within 10s of running the page, the startup report stays incomplete");
+    Finish();
+    return true;
+}
+
+void StartupProfiler::Finish()
+{
+    bool expected = false;
+    if (finished_.compare_exchange_strong(expected, true, std::memory_order_acq_rel)) {
+        LOGI("Startup report: %{public}s", ToJson().c_str());
+    }
+}
+
+void StartupProfiler::BeginPhase(StartupPhase phase)
+{
+    if (IsFinished() || phase >= StartupPhase::COUNT) {
+        return;
+    }
+    int64_t now = GetSysTimestamp();
+    if (FinishIfOverdue(now)) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto& timing = phases_[static_cast<size_t>(phase)];
+    if (timing.begin < 0) {
+        timing.begin = GetOffsetLocked(now);
+    }
+}
+
+void StartupProfiler::EndPhase(StartupPhase phase)
+{
+    if (IsFinished() || phase >= StartupPhase::COUNT) {
+        return;
+    }
+    int64_t now = GetSysTimestamp();
+    if (FinishIfOverdue(now)) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto& timing = phases_[static_cast<size_t>(phase)];
+    if (timing.begin >= 0 && timing.end < 0) {
+        timing.end = GetOffsetLocked(now);
+        if (phase == StartupPhase::RUN_PAGE) {
+            firstFrameDeadline_.store(now + FIRST_FRAME_TIMEOUT, std::memory_order_relaxed);
+        }
+    }
+}
+
+void StartupProfiler::OnFrameBegin()
+{
+    if (IsFinished()) {
+        return;
+    }
+    int64_t now = GetSysTimestamp();
+    if (FinishIfOverdue(now)) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    // Frames before the first page ran belong to an empty window, not to the startup.
+    auto& layout = phases_[static_cast<size_t>(StartupPhase::FIRST_LAYOUT)];
+    if (phases_[static_cast<size_t>(StartupPhase::RUN_PAGE)].end < 0 || layout.begin >= 0) {
+        return;
+    }
+    layout.begin = GetOffsetLocked(now);
+}
+
+void StartupProfiler::OnFrameEnd()
+{
+    if (IsFinished()) {
+        return;
+    }
+    int64_t now = GetSysTimestamp();
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto& layout = phases_[static_cast<size_t>(StartupPhase::FIRST_LAYOUT)];
+        if (layout.begin < 0) {
+            return;
+        }
+        layout.end = GetOffsetLocked(now);
+        auto& frame = phases_[static_cast<size_t>(StartupPhase::FIRST_FRAME)];
+        frame.begin = layout.end;
+        frame.end = layout.end;
+    }
+    Finish();
+}
+
+StartupReport StartupProfiler::GetReport() const
+{
+    StartupReport report;
+    std::lock_guard<std::mutex> lock(mutex_);
+    report.origin = origin_;
+    report.phases = phases_;
+    report.complete = phases_[static_cast<size_t>(StartupPhase::FIRST_FRAME)].begin >= 0;
+    return report;
+}
+
+std::string StartupProfiler::ToJson() const
+{
+    auto report = GetReport();
+    std::string json = "{\"origin\":" + std::to_string(ToMicros(report.origin)) +
+                       ",\"complete\":" + (report.complete ? "true" : "false") + ",\"phases\":[";
+    bool first = true;
+    for (size_t index = 0; index < report.phases.size(); ++index) {
+        const auto& timing = report.phases[index];
+        if (timing.begin < 0) {
+            continue;
+        }
+        json += first ? "" : ",";
+        json += std::string("{\"name\":\"") + PHASE_NAMES[index] + "\",\"begin\":" +
+                std::to_string(ToMicros(timing.begin)) + ",\"end\":" + std::to_string(ToMicros(timing.end)) + "}";
+        first = false;
+    }
+    json += "]}";
+    return json;
+}
+} // namespace OHOS::Ace
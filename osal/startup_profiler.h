@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FOUNDATION_ACE_ADAPTER_ANDROID_OSAL_STARTUP_PROFILER_H
+#define FOUNDATION_ACE_ADAPTER_ANDROID_OSAL_STARTUP_PROFILER_H
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <string>
+
+namespace OHOS::Ace {
+enum class StartupPhase : uint8_t {
+    JNI_ON_LOAD = 0,
+    CLASS_REGISTRATION,
+    HAP_PATH,
+    MODULE_PRELOAD,
+    MODULE_LOAD,
+    ASSET_PROVIDER_INIT,
+    CONTAINER_INIT,
+    RESOURCE_INIT,
+    VIEW_ATTACH,
+    RUN_PAGE,
+    FIRST_LAYOUT,
+    FIRST_FRAME,
+    COUNT,
+};
+
+struct StartupPhaseTiming {
+    // Offsets from the first recorded phase in ns, -1 when the phase did not run.
+    int64_t begin = -1;
+    int64_t end = -1;
+};
+
+struct StartupReport {
+    int64_t origin = 0;
+    std::array<StartupPhaseTiming, static_cast<size_t>(StartupPhase::COUNT)> phases;
+    // True when the first frame was reached.
+    bool complete = false;
+};
+
+// Timestamps the phases of a cold start, from JNI_OnLoad to the first frame. Only the first run of each phase is
+// kept, warm starts of later abilities do not overwrite it. The report is logged once the first frame is done, or
+// once FIRST_FRAME_TIMEOUT passed after RUN_PAGE without one, and every hook is a no-op from then on.
+class StartupProfiler final {
+public:
+    static StartupProfiler& GetInstance();
+
+    void BeginPhase(StartupPhase phase);
+    void EndPhase(StartupPhase phase);
+    // Driven by the vsync frame callback of the window. The first frame after RUN_PAGE spans FIRST_LAYOUT, its end
+    // is FIRST_FRAME.
+    void OnFrameBegin();
+    void OnFrameEnd();
+
+    bool IsFinished() const
+    {
+        return finished_.load(std::memory_order_acquire);
+    }
+
+    StartupReport GetReport() const;
+    // {"origin":...,"complete":...,"phases":[{"name":"...","begin":...,"end":...}]} with times in microseconds.
+    std::string ToJson() const;
+
+    static const char* GetPhaseName(StartupPhase phase);
+
+private:
+    StartupProfiler() = default;
+    ~StartupProfiler() = default;
+    StartupProfiler(const StartupProfiler&) = delete;
+    StartupProfiler& operator=(const StartupProfiler&) = delete;
+
+    int64_t GetOffsetLocked(int64_t now);
+    bool FinishIfOverdue(int64_t now);
+    void Finish();
+
+    std::atomic<bool> finished_ { false };
+    // GetSysTimestamp after which the profiler stops waiting for the first frame, 0 until RUN_PAGE ended.
+    std::atomic<int64_t> firstFrameDeadline_ { 0 };
+    mutable std::mutex mutex_;
+    int64_t origin_ = 0;
+    std::array<StartupPhaseTiming, static_cast<size_t>(StartupPhase::COUNT)> phases_;
+};
+
+class StartupPhaseScope final {
+public:
+    explicit StartupPhaseScope(StartupPhase phase) : phase_(phase)
+    {
+        StartupProfiler::GetInstance().BeginPhase(phase_);
+    }
+
+    ~StartupPhaseScope()
+    {
+        StartupProfiler::GetInstance().EndPhase(phase_);
+    }
+
+private:
+    StartupPhase phase_;
+};
+} // namespace OHOS::Ace
+#endif // FOUNDATION_ACE_ADAPTER_ANDROID_OSAL_STARTUP_PROFILER_H
@@ -15,10 +15,19 @@
 
 #include "core/common/statistic_event_adapter.h"
 
+#include "adapter/android/osal/perf_event_sink.h"
+
 namespace OHOS::Ace {
 void StatisticEventAdapter::ReportStatisticEvents(
     const StatisticAppInfo& appInfo, const std::map<StatisticEventType, StatisticEventInfo>& events)
 {
-    return;
+    auto& sink = PerfEventSink::GetInstance();
+    for (const auto& [type, info] : events) {
+        if (info.cnt <= 0) {
+            continue;
+        }
+        sink.Record(PerfEventType::STATISTIC_EVENT, "", static_cast<int32_t>(type), info.cnt,
+            static_cast<uint32_t>(info.cnt));
+    }
 }
 } // namespace OHOS::Ace
\ No newline at end of file
@@ -0,0 +1,377 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "adapter/android/osal/theme_snapshot.h"
+
+#include <dirent.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+
+#include "base/log/log.h"
+#include "base/thread/background_task_executor.h"
+#include "base/utils/utils.h"
+
+namespace OHOS::Ace {
+namespace {
+constexpr char SNAPSHOT_MAGIC[] = { 'A', 'T', 'S', 'S' };
+constexpr uint32_t SNAPSHOT_VERSION = 1;
+constexpr uint64_t FNV_OFFSET_BASIS = 14695981039346656037ULL;
+constexpr uint64_t FNV_PRIME = 1099511628211ULL;
+constexpr size_t MAX_SNAPSHOT_SIZE = 4 * 1024 * 1024;
+constexpr uint32_t MAX_PATTERN_DEPTH = 4;
+constexpr mode_t SNAPSHOT_DIR_MODE = S_IRWXU;
+constexpr char SNAPSHOT_PREFIX[] = "theme_";
+constexpr char SNAPSHOT_HASH_SEPARATOR = '_';
+constexpr char SNAPSHOT_POSTFIX[] = ".snapshot";
+constexpr char SNAPSHOT_TMP_POSTFIX[] = ".tmp";
+
+uint64_t HashString(const std::string& value)
+{
+    uint64_t hash = FNV_OFFSET_BASIS;
+    for (auto ch : value) {
+        hash = (hash ^ static_cast<uint8_t>(ch)) * FNV_PRIME;
+    }
+    return hash;
+}
+
+// The key stored in the file, a snapshot is only used when it matches completely, hash collisions included.
+std::string GetFullKey(const ThemeSnapshotKey& key)
+{
+    return key.source + "|" + key.stamp + "|" + key.config;
+}
+
+class SnapshotReader final {
+public:
+    SnapshotReader(const uint8_t* data, size_t size) : data_(data), size_(size) {}
+
+    template<typename T>
+    bool ReadValue(T& value)
+    {
+        if (size_ - offset_ < sizeof(T)) {
+            return false;
+        }
+        memcpy(&value, data_ + offset_, sizeof(T));
+        offset_ += sizeof(T);
+        return true;
+    }
+
+    bool ReadString(std::string& value)
+    {
+        uint32_t length = 0;
+        if (!ReadValue(length) || size_ - offset_ < length) {
+            return false;
+        }
+        value.assign(reinterpret_cast<const char*>(data_ + offset_), length);
+        offset_ += length;
+        return true;
+    }
+
+    bool IsEnd() const
+    {
+        return offset_ == size_;
+    }
+
+private:
+    const uint8_t* data_;
+    size_t size_;
+    size_t offset_ = 0;
+};
+
+template<typename T>
+void AppendValue(std::vector<uint8_t>& buffer, T value)
+{
+    auto* bytes = reinterpret_cast<const uint8_t*>(&value);
+    buffer.insert(buffer.end(), bytes, bytes + sizeof(T));
+}
+
+void AppendString(std::vector<uint8_t>& buffer, const std::string& value)
+{
+    AppendValue(buffer, static_cast<uint32_t>(value.size()));
+    buffer.insert(buffer.end(), value.begin(), value.end());
+}
+} // namespace
+
+// Friend of ResourceThemeStyle, the attributes of a style are protected members of ThemeStyle.
+class ThemeSnapshotCodec final {
+public:
+    static bool Encode(const RefPtr<ResourceThemeStyle>& style, uint32_t depth, std::vector<uint8_t>& buffer)
+    {
+        AppendValue(buffer, static_cast<uint32_t>(style->attributes_.size()));
+        for (const auto& [name, attr] : style->attributes_) {
+            AppendString(buffer, name);
+            AppendValue(buffer, static_cast<uint8_t>(attr.type));
+            if (!EncodeValue(attr, depth, buffer)) {
+                LOGW("Theme attr %{public}s can not be snapshotted, type: %{public}d", name.c_str(),
+                    static_cast<int32_t>(attr.type));
+                return false;
+            }
+        }
+        return true;
+    }
+
+    static bool Decode(SnapshotReader& reader, const RefPtr<ResourceThemeStyle>& style, uint32_t depth)
+    {
+        uint32_t count = 0;
+        if (!reader.ReadValue(count)) {
+            return false;
+        }
+        for (uint32_t index = 0; index < count; ++index) {
+            std::string name;
+            uint8_t type = 0;
+            if (!reader.ReadString(name) || !reader.ReadValue(type) ||
+                !DecodeValue(reader, style, name, static_cast<ThemeConstantsType>(type), depth)) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+private:
+    static bool EncodeValue(const ResValueWrapper& attr, uint32_t depth, std::vector<uint8_t>& buffer)
+    {
+        switch (attr.type) {
+            case ThemeConstantsType::COLOR: {
+                auto* color = std::get_if<Color>(&attr.value);
+                CHECK_NULL_RETURN(color, false);
+                AppendValue(buffer, color->GetValue());
+                return true;
+            }
+            case ThemeConstantsType::STRING:
+            case ThemeConstantsType::REFERENCE_ATTR: {
+                auto* value = std::get_if<std::string>(&attr.value);
+                CHECK_NULL_RETURN(value, false);
+                AppendString(buffer, *value);
+                return true;
+            }
+            case ThemeConstantsType::DOUBLE: {
+                auto* value = std::get_if<double>(&attr.value);
+                CHECK_NULL_RETURN(value, false);
+                AppendValue(buffer, *value);
+                return true;
+            }
+            case ThemeConstantsType::DIMENSION: {
+                auto* dimension = std::get_if<Dimension>(&attr.value);
+                CHECK_NULL_RETURN(dimension, false);
+                AppendValue(buffer, dimension->Value());
+                AppendValue(buffer, static_cast<int32_t>(dimension->Unit()));
+                return true;
+            }
+            case ThemeConstantsType::PATTERN: {
+                auto* pattern = std::get_if<RefPtr<ThemeStyle>>(&attr.value);
+                CHECK_NULL_RETURN(pattern, false);
+                auto patternStyle = AceType::DynamicCast<ResourceThemeStyle>(*pattern);
+                CHECK_NULL_RETURN(patternStyle, false);
+                return depth < MAX_PATTERN_DEPTH && Encode(patternStyle, depth + 1, buffer);
+            }
+            default:
+                return false;
+        }
+    }
+
+    static bool DecodeValue(SnapshotReader& reader, const RefPtr<ResourceThemeStyle>& style, const std::string& name,
+        ThemeConstantsType type, uint32_t depth)
+    {
+        switch (type) {
+            case ThemeConstantsType::COLOR: {
+                uint32_t value = 0;
+                if (!reader.ReadValue(value)) {
+                    return false;
+                }
+                style->attributes_[name] = { .type = type, .value = Color(value) };
+                return true;
+            }
+            case ThemeConstantsType::STRING:
+            case ThemeConstantsType::REFERENCE_ATTR: {
+                std::string value;
+                if (!reader.ReadString(value)) {
+                    return false;
+                }
+                style->attributes_[name] = { .type = type, .value = std::move(value) };
+                return true;
+            }
+            case ThemeConstantsType::DOUBLE: {
+                double value = 0.0;
+                if (!reader.ReadValue(value)) {
+                    return false;
+                }
+                style->attributes_[name] = { .type = type, .value = value };
+                return true;
+            }
+            case ThemeConstantsType::DIMENSION: {
+                double value = 0.0;
+                int32_t unit = 0;
+                if (!reader.ReadValue(value) || !reader.ReadValue(unit)) {
+                    return false;
+                }
+                style->attributes_[name] = { .type = type,
+                    .value = Dimension(value, static_cast<DimensionUnit>(unit)) };
+                return true;
+            }
+            case ThemeConstantsType::PATTERN: {
+                if (depth >= MAX_PATTERN_DEPTH) {
+                    return false;
+                }
+                auto patternStyle = AceType::MakeRefPtr<ResourceThemeStyle>(style->resAdapter_);
+                patternStyle->SetName(name);
+                patternStyle->parentStyle_ = AceType::WeakClaim(AceType::RawPtr(style));
+                if (!Decode(reader, patternStyle, depth + 1)) {
+                    return false;
+                }
+                style->attributes_[name] = { .type = type, .value = RefPtr<ThemeStyle>(std::move(patternStyle)) };
+                return true;
+            }
+            default:
+                return false;
+        }
+    }
+};
+
+ThemeSnapshot& ThemeSnapshot::GetInstance()
+{
+    static ThemeSnapshot instance;
+    return instance;
+}
+
+void ThemeSnapshot::SetCacheDir(const std::string& cacheDir)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    cacheDir_ = cacheDir;
+}
+
+bool ThemeSnapshot::Load(const ThemeSnapshotKey& key, const RefPtr<ResourceThemeStyle>& theme)
+{
+    CHECK_NULL_RETURN(theme, false);
+    auto path = GetSnapshotPath(key);
+    if (path.empty()) {
+        return false;
+    }
+    int fd = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        return false;
+    }
+    struct stat fileStat {};
+    if (fstat(fd, &fileStat) != 0 || fileStat.st_size <= 0 ||
+        static_cast<size_t>(fileStat.st_size) > MAX_SNAPSHOT_SIZE) {
+        close(fd);
+        return false;
+    }
+    auto size = static_cast<size_t>(fileStat.st_size);
+    void* data = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (data == MAP_FAILED) {
+        LOGW("Map theme snapshot failed, errno: %{public}d", errno);
+        return false;
+    }
+    SnapshotReader reader(static_cast<const uint8_t*>(data), size);
+    char magic[sizeof(SNAPSHOT_MAGIC)] = { 0 };
+    uint32_t version = 0;
+    std::string fileKey;
+    bool ret = reader.ReadValue(magic) && memcmp(magic, SNAPSHOT_MAGIC, sizeof(magic)) == 0 &&
+               reader.ReadValue(version) && version == SNAPSHOT_VERSION && reader.ReadString(fileKey) &&
+               fileKey == GetFullKey(key) && ThemeSnapshotCodec::Decode(reader, theme, 0) && reader.IsEnd();
+    munmap(data, size);
+    if (!ret) {
+        // A file of another key only collides on the hash, a broken one is written again after this parse.
+        LOGW("Theme snapshot %{public}s is not usable", path.c_str());
+        theme->attributes_.clear();
+    }
+    return ret;
+}
+
+void ThemeSnapshot::Store(const ThemeSnapshotKey& key, const RefPtr<ResourceThemeStyle>& theme)
+{
+    CHECK_NULL_VOID(theme);
+    auto path = GetSnapshotPath(key);
+    if (path.empty()) {
+        return;
+    }
+    std::vector<uint8_t> buffer;
+    buffer.insert(buffer.end(), SNAPSHOT_MAGIC, SNAPSHOT_MAGIC + sizeof(SNAPSHOT_MAGIC));
+    AppendValue(buffer, SNAPSHOT_VERSION);
+    AppendString(buffer, GetFullKey(key));
+    if (!ThemeSnapshotCodec::Encode(theme, 0, buffer)) {
+        return;
+    }
+    BackgroundTaskExecutor::GetInstance().PostTask(
+        [path, buffer = std::move(buffer)]() { WriteSnapshot(path, buffer); });
+}
+
+std::string ThemeSnapshot::GetSnapshotPath(const ThemeSnapshotKey& key)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (cacheDir_.empty() || !key.IsValid()) {
+        return "";
+    }
+    return cacheDir_ + "/" + SNAPSHOT_PREFIX + std::to_string(HashString(key.source)) + SNAPSHOT_HASH_SEPARATOR +
+           std::to_string(HashString(key.stamp)) + SNAPSHOT_HASH_SEPARATOR + std::to_string(HashString(key.config)) +
+           SNAPSHOT_POSTFIX;
+}
+
+void ThemeSnapshot::WriteSnapshot(const std::string& path, const std::vector<uint8_t>& buffer)
+{
+    auto dir = path.substr(0, path.rfind('/'));
+    if (mkdir(dir.c_str(), SNAPSHOT_DIR_MODE) != 0 && errno != EEXIST) {
+        LOGW("Make theme snapshot dir failed, errno: %{public}d", errno);
+        return;
+    }
+    std::string tmpPath = path + SNAPSHOT_TMP_POSTFIX;
+    std::FILE* fp = std::fopen(tmpPath.c_str(), "wb");
+    if (fp == nullptr) {
+        LOGW("Open theme snapshot %{public}s failed, errno: %{public}d", tmpPath.c_str(), errno);
+        return;
+    }
+    bool ret = std::fwrite(buffer.data(), 1, buffer.size(), fp) == buffer.size();
+    ret = (std::fclose(fp) == 0) && ret;
+    if (!ret || std::rename(tmpPath.c_str(), path.c_str()) != 0) {
+        LOGW("Write theme snapshot %{public}s failed, errno: %{public}d", path.c_str(), errno);
+        std::remove(tmpPath.c_str());
+        return;
+    }
+    RemoveOutdatedSnapshots(path);
+}
+
+void ThemeSnapshot::RemoveOutdatedSnapshots(const std::string& path)
+{
+    auto nameBegin = path.rfind('/') + 1;
+    auto sourceEnd = path.find(SNAPSHOT_HASH_SEPARATOR, nameBegin + strlen(SNAPSHOT_PREFIX));
+    auto stampEnd = path.find(SNAPSHOT_HASH_SEPARATOR, sourceEnd + 1);
+    if (sourceEnd == std::string::npos || stampEnd == std::string::npos) {
+        return;
+    }
+    auto dir = path.substr(0, nameBegin - 1);
+    // theme_<source hash>_ and theme_<source hash>_<stamp hash>_
+    auto sourcePrefix = path.substr(nameBegin, sourceEnd + 1 - nameBegin);
+    auto stampPrefix = path.substr(nameBegin, stampEnd + 1 - nameBegin);
+    DIR* snapshotDir = opendir(dir.c_str());
+    if (snapshotDir == nullptr) {
+        return;
+    }
+    struct dirent* entry = nullptr;
+    while ((entry = readdir(snapshotDir)) != nullptr) {
+        std::string name(entry->d_name);
+        if (name.compare(0, sourcePrefix.size(), sourcePrefix) == 0 &&
+            name.compare(0, stampPrefix.size(), stampPrefix) != 0) {
+            std::remove((dir + "/" + name).c_str());
+        }
+    }
+    closedir(snapshotDir);
+}
+} // namespace OHOS::Ace
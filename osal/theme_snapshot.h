@@ -0,0 +1,77 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FOUNDATION_ACE_ADAPTER_ANDROID_OSAL_THEME_SNAPSHOT_H
+#define FOUNDATION_ACE_ADAPTER_ANDROID_OSAL_THEME_SNAPSHOT_H
+
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "adapter/android/osal/resource_theme_style.h"
+
+namespace OHOS::Ace {
+struct ThemeSnapshotKey {
+    // Paths of the resources.index files the theme is parsed from.
+    std::string source;
+    // Size and mtime of those files, snapshots of the same source with another stamp are outdated.
+    std::string stamp;
+    // Theme id and resource configuration.
+    std::string config;
+
+    bool IsValid() const
+    {
+        return !source.empty() && !config.empty();
+    }
+};
+
+// Caches the parsed attributes of a theme on disk, one file per resource configuration. A snapshot holds typed
+// values, so loading it takes no GetThemeById call and no classification of attribute strings.
+//
+// Files are named theme_<source hash>_<stamp hash>_<config hash>.snapshot, writing a snapshot removes those of
+// the same source with another stamp, left behind by an app or engine update.
+//
+// Layout, native endian: magic "ATSS", uint32 version, uint32 key size, key, then the root style. A style is a
+// uint32 attribute count followed per attribute by uint32 name size, name, uint8 ThemeConstantsType and the value:
+// uint32 ARGB for COLOR, a sized string for STRING and REFERENCE_ATTR, a double for DOUBLE, a double and an int32
+// DimensionUnit for DIMENSION, and a nested style for PATTERN.
+class ThemeSnapshot final {
+public:
+    static ThemeSnapshot& GetInstance();
+
+    // Snapshots are only used once the directory is set.
+    void SetCacheDir(const std::string& cacheDir);
+    // Fills the attributes of theme from the snapshot of key, false when there is no valid one.
+    bool Load(const ThemeSnapshotKey& key, const RefPtr<ResourceThemeStyle>& theme);
+    // Serializes theme on the calling thread and writes the file on a background thread.
+    void Store(const ThemeSnapshotKey& key, const RefPtr<ResourceThemeStyle>& theme);
+
+private:
+    ThemeSnapshot() = default;
+    ~ThemeSnapshot() = default;
+    ThemeSnapshot(const ThemeSnapshot&) = delete;
+    ThemeSnapshot& operator=(const ThemeSnapshot&) = delete;
+
+    std::string GetSnapshotPath(const ThemeSnapshotKey& key);
+    static void WriteSnapshot(const std::string& path, const std::vector<uint8_t>& buffer);
+    // Removes the snapshots of the source of path that carry another stamp.
+    static void RemoveOutdatedSnapshots(const std::string& path);
+
+    std::mutex mutex_;
+    std::string cacheDir_;
+};
+} // namespace OHOS::Ace
+#endif // FOUNDATION_ACE_ADAPTER_ANDROID_OSAL_THEME_SNAPSHOT_H
@@ -19,6 +19,8 @@
 
 #include "base/thread/thread_priority.h"
 
+#include "adapter/android/osal/thread_sched_policy.h"
+
 namespace OHOS::Ace {
 namespace {
 constexpr int32_t BACKGROUND_THREAD_PRIORITY = 15;
@@ -26,9 +28,7 @@ constexpr int32_t BACKGROUND_THREAD_PRIORITY = 15;
 
 void ThreadPriority::SetThreadPriority(OHOS::Ace::TaskExecutor::TaskType taskType)
 {
-    if (taskType == OHOS::Ace::TaskExecutor::TaskType::BACKGROUND) {
-        SetBackGroundThreadPriority();
-    }
+    ThreadSchedPolicy::GetInstance().ApplyThreadPolicy(taskType);
 }
 
 void ThreadPriority::SetBackGroundThreadPriority()
@@ -0,0 +1,292 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "adapter/android/osal/thread_sched_policy.h"
+
+#include <sys/resource.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <climits>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+#include "base/log/log.h"
+#include "base/utils/time_util.h"
+
+namespace OHOS::Ace {
+namespace {
+// Values follow android.os.Process thread priorities.
+constexpr int32_t UI_THREAD_NICE = -10;
+constexpr int32_t RENDER_THREAD_NICE = -10;
+constexpr int32_t JS_THREAD_NICE = -4;
+constexpr int32_t BACKGROUND_THREAD_NICE = 15;
+constexpr int32_t BOOST_THREAD_NICE = -16;
+constexpr int32_t KEEP_NICE = INT32_MAX;
+
+constexpr int64_t NANOS_PER_MILLI = 1000000;
+constexpr int64_t TOUCH_DOWN_BOOST_MS = 200;
+constexpr int64_t PAGE_TRANSITION_BOOST_MS = 500;
+constexpr int64_t SLIDE_BOOST_MS = 300;
+constexpr int64_t FRAME_BOOST_MS = 50;
+// Per-frame hooks fire on every vsync while busy, they may start one boost per interval and no more.
+constexpr int64_t FRAME_BOOST_INTERVAL_MS = 500;
+constexpr char CPU_MAX_FREQ_PATH[] = "/sys/devices/system/cpu/cpu%d/cpufreq/cpuinfo_max_freq";
+constexpr int32_t CPU_PATH_MAX_LEN = 64;
+
+enum class CoreClass : uint8_t {
+    ANY = 0,
+    BIG,
+    LITTLE,
+};
+
+struct ThreadPolicy {
+    int32_t nice;
+    CoreClass coreClass;
+    bool boostable;
+};
+
+ThreadPolicy GetThreadPolicy(TaskExecutor::TaskType taskType)
+{
+    switch (taskType) {
+        case TaskExecutor::TaskType::UI:
+            return { UI_THREAD_NICE, CoreClass::BIG, true };
+        case TaskExecutor::TaskType::GPU:
+            return { RENDER_THREAD_NICE, CoreClass::BIG, true };
+        case TaskExecutor::TaskType::JS:
+            return { JS_THREAD_NICE, CoreClass::ANY, false };
+        case TaskExecutor::TaskType::BACKGROUND:
+            return { BACKGROUND_THREAD_NICE, CoreClass::LITTLE, false };
+        default:
+            return { KEEP_NICE, CoreClass::ANY, false };
+    }
+}
+
+int64_t GetBoostDuration(BoostScene scene)
+{
+    switch (scene) {
+        case BoostScene::TOUCH_DOWN:
+            return TOUCH_DOWN_BOOST_MS;
+        case BoostScene::PAGE_TRANSITION:
+            return PAGE_TRANSITION_BOOST_MS;
+        case BoostScene::SLIDE:
+            return SLIDE_BOOST_MS;
+        default:
+            return FRAME_BOOST_MS;
+    }
+}
+
+int64_t GetBoostInterval(BoostScene scene)
+{
+    switch (scene) {
+        case BoostScene::FLUSH_DIRTY_NODE:
+        case BoostScene::DISPLAY_SYNC:
+            return FRAME_BOOST_INTERVAL_MS;
+        default:
+            return 0;
+    }
+}
+
+int64_t ReadCpuMaxFreq(int32_t cpu)
+{
+    char path[CPU_PATH_MAX_LEN] = { 0 };
+    if (snprintf(path, sizeof(path), CPU_MAX_FREQ_PATH, cpu) <= 0) {
+        return -1;
+    }
+    FILE* file = fopen(path, "r");
+    if (file == nullptr) {
+        return -1;
+    }
+    long long freq = -1;
+    if (fscanf(file, "%lld", &freq) != 1) {
+        freq = -1;
+    }
+    fclose(file);
+    return static_cast<int64_t>(freq);
+}
+} // namespace
+
+ThreadSchedPolicy& ThreadSchedPolicy::GetInstance()
+{
+    static ThreadSchedPolicy instance;
+    return instance;
+}
+
+ThreadSchedPolicy::ThreadSchedPolicy()
+{
+    InitCpuTopology();
+}
+
+ThreadSchedPolicy::~ThreadSchedPolicy()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stopped_ = true;
+    }
+    boostCondition_.notify_all();
+    if (boostThread_.joinable()) {
+        boostThread_.join();
+    }
+}
+
+void ThreadSchedPolicy::InitCpuTopology()
+{
+    CPU_ZERO(&bigCores_);
+    CPU_ZERO(&littleCores_);
+    int32_t cpuCount = static_cast<int32_t>(sysconf(_SC_NPROCESSORS_CONF));
+    if (cpuCount <= 0 || cpuCount > CPU_SETSIZE) {
+        return;
+    }
+    std::vector<int64_t> freqs(cpuCount);
+    int64_t minFreq = INT64_MAX;
+    int64_t maxFreq = 0;
+    for (int32_t cpu = 0; cpu < cpuCount; ++cpu) {
+        freqs[cpu] = ReadCpuMaxFreq(cpu);
+        if (freqs[cpu] <= 0) {
+            LOGI("cpu topology unavailable, thread affinity is left to the kernel");
+            return;
+        }
+        minFreq = std::min(minFreq, freqs[cpu]);
+        maxFreq = std::max(maxFreq, freqs[cpu]);
+    }
+    if (minFreq == maxFreq) {
+        return;
+    }
+    for (int32_t cpu = 0; cpu < cpuCount; ++cpu) {
+        if (freqs[cpu] == minFreq) {
+            CPU_SET(cpu, &littleCores_);
+        } else {
+            CPU_SET(cpu, &bigCores_);
+        }
+    }
+    isHeterogeneous_ = true;
+    LOGI("cpu topology: %{public}d little cores, %{public}d big cores", CPU_COUNT(&littleCores_),
+        CPU_COUNT(&bigCores_));
+}
+
+bool ThreadSchedPolicy::SetThreadNice(pid_t tid, int32_t nice)
+{
+    if (nice == KEEP_NICE) {
+        return true;
+    }
+    if (setpriority(PRIO_PROCESS, tid, nice) < 0) {
+        if (errno == ESRCH) {
+            return false;
+        }
+        LOGW("Failed to set priority %{public}d of thread %{public}d: %{public}s", nice, tid, strerror(errno));
+    }
+    return true;
+}
+
+void ThreadSchedPolicy::SetThreadAffinity(pid_t tid, const cpu_set_t& cpuSet)
+{
+    if (sched_setaffinity(tid, sizeof(cpu_set_t), &cpuSet) < 0) {
+        LOGW("Failed to set affinity of thread %{public}d: %{public}s", tid, strerror(errno));
+    }
+}
+
+void ThreadSchedPolicy::ApplyThreadPolicy(TaskExecutor::TaskType taskType)
+{
+    auto policy = GetThreadPolicy(taskType);
+    pid_t tid = gettid();
+    std::lock_guard<std::mutex> lock(mutex_);
+    // A tid of an exited thread may be reused by the kernel, keep it under its current type only.
+    for (auto& [type, tids] : threadIds_) {
+        if (type != static_cast<uint32_t>(taskType)) {
+            tids.erase(tid);
+        }
+    }
+    threadIds_[static_cast<uint32_t>(taskType)].insert(tid);
+    SetThreadNice(tid, (policy.boostable && IsBoosting()) ? BOOST_THREAD_NICE : policy.nice);
+    if (!isHeterogeneous_) {
+        return;
+    }
+    if (policy.coreClass == CoreClass::BIG) {
+        SetThreadAffinity(tid, bigCores_);
+    } else if (policy.coreClass == CoreClass::LITTLE) {
+        SetThreadAffinity(tid, littleCores_);
+    }
+}
+
+void ThreadSchedPolicy::ApplyBoostLocked(bool boost)
+{
+    for (auto& [type, tids] : threadIds_) {
+        auto policy = GetThreadPolicy(static_cast<TaskExecutor::TaskType>(type));
+        if (!policy.boostable) {
+            continue;
+        }
+        for (auto iter = tids.begin(); iter != tids.end();) {
+            // Threads of destroyed containers have exited, forget them.
+            if (SetThreadNice(*iter, boost ? BOOST_THREAD_NICE : policy.nice)) {
+                ++iter;
+            } else {
+                iter = tids.erase(iter);
+            }
+        }
+    }
+}
+
+void ThreadSchedPolicy::Boost(BoostScene scene)
+{
+    int64_t now = GetSysTimestamp();
+    int64_t interval = GetBoostInterval(scene) * NANOS_PER_MILLI;
+    if (interval > 0) {
+        auto& lastBoost = lastSceneBoost_[static_cast<size_t>(scene)];
+        int64_t last = lastBoost.load(std::memory_order_relaxed);
+        if (now - last < interval || !lastBoost.compare_exchange_strong(last, now, std::memory_order_relaxed)) {
+            return;
+        }
+    }
+    int64_t deadline = now + GetBoostDuration(scene) * NANOS_PER_MILLI;
+    // Touch moves and per-frame hooks call this repeatedly, a request already covered by the running boost is lock free.
+    if (IsBoosting() && deadline <= boostDeadline_.load(std::memory_order_relaxed)) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (deadline > boostDeadline_.load(std::memory_order_relaxed)) {
+        boostDeadline_.store(deadline, std::memory_order_relaxed);
+    }
+    if (IsBoosting()) {
+        return;
+    }
+    ApplyBoostLocked(true);
+    boosting_.store(true, std::memory_order_release);
+    if (!boostThread_.joinable()) {
+        boostThread_ = std::thread([this]() { BoostWorker(); });
+    }
+    boostCondition_.notify_one();
+}
+
+void ThreadSchedPolicy::BoostWorker()
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (!stopped_) {
+        if (!IsBoosting()) {
+            boostCondition_.wait(lock, [this]() { return stopped_ || IsBoosting(); });
+            continue;
+        }
+        int64_t remaining = boostDeadline_.load(std::memory_order_relaxed) - GetSysTimestamp();
+        if (remaining > 0) {
+            boostCondition_.wait_for(lock, std::chrono::nanoseconds(remaining));
+            continue;
+        }
+        ApplyBoostLocked(false);
+        boosting_.store(false, std::memory_order_release);
+    }
+}
+} // namespace OHOS::Ace
@@ -0,0 +1,84 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FOUNDATION_ACE_ADAPTER_ANDROID_OSAL_THREAD_SCHED_POLICY_H
+#define FOUNDATION_ACE_ADAPTER_ANDROID_OSAL_THREAD_SCHED_POLICY_H
+
+#include <sched.h>
+#include <sys/types.h>
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
+
+#include "base/thread/task_executor.h"
+
+namespace OHOS::Ace {
+enum class BoostScene : uint8_t {
+    TOUCH_DOWN = 0,
+    PAGE_TRANSITION,
+    SLIDE,
+    FLUSH_DIRTY_NODE,
+    DISPLAY_SYNC,
+    COUNT,
+};
+
+// Assigns nice values and CPU affinity to engine threads by TaskExecutor thread type, and temporarily raises the
+// priority of the UI and render threads around latency sensitive scenes.
+class ThreadSchedPolicy final {
+public:
+    static ThreadSchedPolicy& GetInstance();
+
+    // Applies the policy of |taskType| to the calling thread.
+    void ApplyThreadPolicy(TaskExecutor::TaskType taskType);
+    void Boost(BoostScene scene);
+
+    bool IsBoosting() const
+    {
+        return boosting_.load(std::memory_order_acquire);
+    }
+
+private:
+    ThreadSchedPolicy();
+    ~ThreadSchedPolicy();
+    ThreadSchedPolicy(const ThreadSchedPolicy&) = delete;
+    ThreadSchedPolicy& operator=(const ThreadSchedPolicy&) = delete;
+
+    void InitCpuTopology();
+    bool SetThreadNice(pid_t tid, int32_t nice);
+    void SetThreadAffinity(pid_t tid, const cpu_set_t& cpuSet);
+    void ApplyBoostLocked(bool boost);
+    void BoostWorker();
+
+    cpu_set_t bigCores_;
+    cpu_set_t littleCores_;
+    bool isHeterogeneous_ = false;
+
+    std::mutex mutex_;
+    std::condition_variable boostCondition_;
+    // Every container runs its own UI thread, so a type maps to all threads registered with it.
+    std::unordered_map<uint32_t, std::unordered_set<pid_t>> threadIds_;
+    std::atomic<bool> boosting_ { false };
+    std::atomic<int64_t> boostDeadline_ { 0 };
+    std::atomic<int64_t> lastSceneBoost_[static_cast<size_t>(BoostScene::COUNT)] {};
+    std::thread boostThread_;
+    bool stopped_ = false;
+};
+} // namespace OHOS::Ace
+#endif // FOUNDATION_ACE_ADAPTER_ANDROID_OSAL_THREAD_SCHED_POLICY_H
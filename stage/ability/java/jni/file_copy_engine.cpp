@@ -0,0 +1,273 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "file_copy_engine.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <cstring>
+#include <dirent.h>
+#include <fcntl.h>
+#include <sys/sendfile.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <thread>
+#include <unistd.h>
+#include <utility>
+#include <vector>
+
+#if defined(__ANDROID__)
+#include <android/api-level.h>
+#endif
+
+#include "base/log/log.h"
+
+namespace OHOS {
+namespace AbilityRuntime {
+namespace Platform {
+namespace {
+constexpr size_t MAX_COPY_WORKERS = 4;
+constexpr size_t FILES_PER_WORKER = 8;
+constexpr size_t COPY_BUFFER_SIZE = 64 * 1024;
+constexpr size_t MAX_KERNEL_CHUNK = 1024 * 1024 * 1024;
+constexpr mode_t FILE_MODE = S_IRUSR | S_IWUSR | S_IRGRP | S_IWGRP | S_IROTH | S_IWOTH;
+constexpr mode_t DIR_MODE = S_IRWXU | S_IRWXG | S_IROTH | S_IXOTH;
+#if defined(__ANDROID__)
+// The seccomp policy of older releases kills the app on copy_file_range, bionic wraps it since API 34.
+constexpr int COPY_FILE_RANGE_MIN_API = 34;
+#endif
+
+using CopyTask = std::pair<std::string, std::string>;
+
+bool IsCopyFileRangeAllowed()
+{
+#if defined(__NR_copy_file_range) && defined(__ANDROID__)
+    static const bool allowed = android_get_device_api_level() >= COPY_FILE_RANGE_MIN_API;
+    return allowed;
+#elif defined(__NR_copy_file_range)
+    return true;
+#else
+    return false;
+#endif
+}
+
+bool IsUpToDate(const struct stat& sourceStat, const std::string& target)
+{
+    struct stat targetStat {};
+    return stat(target.c_str(), &targetStat) == 0 && S_ISREG(targetStat.st_mode) &&
+           targetStat.st_size == sourceStat.st_size && targetStat.st_mtim.tv_sec == sourceStat.st_mtim.tv_sec &&
+           targetStat.st_mtim.tv_nsec == sourceStat.st_mtim.tv_nsec;
+}
+
+bool WriteAll(int fd, const uint8_t* data, size_t size)
+{
+    while (size > 0) {
+        ssize_t written = write(fd, data, size);
+        if (written < 0 && errno == EINTR) {
+            continue;
+        }
+        if (written <= 0) {
+            return false;
+        }
+        data += written;
+        size -= static_cast<size_t>(written);
+    }
+    return true;
+}
+
+bool CopyBuffered(int in, int out)
+{
+    std::vector<uint8_t> buffer(COPY_BUFFER_SIZE);
+    while (true) {
+        ssize_t bytes = read(in, buffer.data(), buffer.size());
+        if (bytes < 0 && errno == EINTR) {
+            continue;
+        }
+        if (bytes < 0) {
+            return false;
+        }
+        if (bytes == 0) {
+            return true;
+        }
+        if (!WriteAll(out, buffer.data(), static_cast<size_t>(bytes))) {
+            return false;
+        }
+    }
+}
+
+// Both calls advance the file offsets, so the buffered copy can take over at any point.
+bool CopyContent(int in, int out, size_t size)
+{
+    bool useCopyFileRange = IsCopyFileRangeAllowed();
+    size_t copied = 0;
+    while (copied < size) {
+        size_t chunk = std::min(size - copied, MAX_KERNEL_CHUNK);
+        ssize_t bytes = -1;
+#if defined(__NR_copy_file_range)
+        if (useCopyFileRange) {
+            bytes = syscall(__NR_copy_file_range, in, nullptr, out, nullptr, chunk, 0);
+            if (bytes < 0 && errno != EINTR) {
+                useCopyFileRange = false;
+                continue;
+            }
+        } else {
+            bytes = sendfile(out, in, nullptr, chunk);
+        }
+#else
+        bytes = sendfile(out, in, nullptr, chunk);
+#endif
+        if (bytes < 0 && errno == EINTR) {
+            continue;
+        }
+        if (bytes <= 0) {
+            break;
+        }
+        copied += static_cast<size_t>(bytes);
+    }
+    return copied == size || CopyBuffered(in, out);
+}
+
+bool CollectFiles(const std::string& source, const std::string& target, const FileCopyEngine::NameFilter& filter,
+    std::vector<CopyTask>& tasks)
+{
+    DIR* dir = opendir(source.c_str());
+    if (dir == nullptr) {
+        LOGE("source dir open error!");
+        return false;
+    }
+    if (mkdir(target.c_str(), DIR_MODE) != 0 && errno != EEXIST) {
+        LOGE("make dir error, errno: %{public}d", errno);
+        closedir(dir);
+        return false;
+    }
+    bool ret = true;
+    struct dirent* entry = nullptr;
+    while ((entry = readdir(dir)) != nullptr) {
+        if (strcmp(entry->d_name, ".") == 0 || strcmp(entry->d_name, "..") == 0 ||
+            (filter && !filter(entry->d_name))) {
+            continue;
+        }
+        std::string sourcePath = source + "/" + entry->d_name;
+        std::string targetPath = target + "/" + entry->d_name;
+        struct stat st {};
+        if (stat(sourcePath.c_str(), &st) != 0) {
+            continue;
+        }
+        if (S_ISDIR(st.st_mode)) {
+            ret = CollectFiles(sourcePath, targetPath, filter, tasks) && ret;
+        } else if (S_ISREG(st.st_mode)) {
+            tasks.emplace_back(std::move(sourcePath), std::move(targetPath));
+        }
+    }
+    closedir(dir);
+    return ret;
+}
+} // namespace
+
+bool FileCopyEngine::CopyFile(const std::string& source, const std::string& target)
+{
+    int in = open(source.c_str(), O_RDONLY | O_CLOEXEC);
+    if (in < 0) {
+        LOGE("open sourcefile error!");
+        return false;
+    }
+    struct stat sourceStat {};
+    if (fstat(in, &sourceStat) != 0 || !S_ISREG(sourceStat.st_mode)) {
+        close(in);
+        return false;
+    }
+    if (IsUpToDate(sourceStat, target)) {
+        close(in);
+        return true;
+    }
+    int out = open(target.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, FILE_MODE);
+    if (out < 0) {
+        LOGE("new file error!");
+        close(in);
+        return false;
+    }
+    bool ret = CopyContent(in, out, static_cast<size_t>(sourceStat.st_size));
+    if (ret) {
+        // Only a complete copy gets the source mtime, a partial one is copied again next time.
+        struct timespec times[] = { sourceStat.st_atim, sourceStat.st_mtim };
+        futimens(out, times);
+    } else {
+        LOGE("copy file failed, errno: %{public}d", errno);
+    }
+    close(out);
+    close(in);
+    return ret;
+}
+
+bool FileCopyEngine::CopyDir(const std::string& source, const std::string& target, const NameFilter& filter)
+{
+    struct stat st {};
+    if (stat(source.c_str(), &st) < 0 || !S_ISDIR(st.st_mode)) {
+        LOGE("source is null!");
+        return false;
+    }
+    std::vector<CopyTask> tasks;
+    bool ret = CollectFiles(source, target, filter, tasks);
+    if (tasks.empty()) {
+        return ret;
+    }
+
+    size_t workerCount = (tasks.size() + FILES_PER_WORKER - 1) / FILES_PER_WORKER;
+    workerCount = std::min({ workerCount, MAX_COPY_WORKERS,
+        static_cast<size_t>(std::max(std::thread::hardware_concurrency(), 1U)) });
+    std::atomic<size_t> next { 0 };
+    std::atomic<bool> succeeded { true };
+    auto copyWorker = [&tasks, &next, &succeeded]() {
+        for (size_t index = next.fetch_add(1); index < tasks.size(); index = next.fetch_add(1)) {
+            if (!CopyFile(tasks[index].first, tasks[index].second)) {
+                succeeded.store(false, std::memory_order_relaxed);
+            }
+        }
+    };
+    std::vector<std::thread> workers;
+    for (size_t index = 1; index < workerCount; ++index) {
+        workers.emplace_back(copyWorker);
+    }
+    copyWorker();
+    for (auto& worker : workers) {
+        worker.join();
+    }
+    return ret && succeeded.load(std::memory_order_relaxed);
+}
+
+bool FileCopyEngine::WriteBuffer(const uint8_t* data, size_t size, const std::string& target, time_t notBefore)
+{
+    struct stat targetStat {};
+    if (stat(target.c_str(), &targetStat) == 0 && S_ISREG(targetStat.st_mode) &&
+        static_cast<size_t>(targetStat.st_size) == size && targetStat.st_mtim.tv_sec >= notBefore) {
+        return true;
+    }
+    int out = open(target.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, FILE_MODE);
+    if (out < 0) {
+        LOGE("new file error!");
+        return false;
+    }
+    bool ret = WriteAll(out, data, size);
+    close(out);
+    if (!ret) {
+        // Removed so the size check cannot mistake a short write for an up to date file.
+        unlink(target.c_str());
+    }
+    return ret;
+}
+} // namespace Platform
+} // namespace AbilityRuntime
+} // namespace OHOS
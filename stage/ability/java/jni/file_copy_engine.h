@@ -0,0 +1,48 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FOUNDATION_ACE_ADAPTER_ANDROID_STAGE_ABILITY_JAVA_JNI_FILE_COPY_ENGINE_H
+#define FOUNDATION_ACE_ADAPTER_ANDROID_STAGE_ABILITY_JAVA_JNI_FILE_COPY_ENGINE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <ctime>
+#include <functional>
+#include <string>
+
+namespace OHOS {
+namespace AbilityRuntime {
+namespace Platform {
+// Copies module files in the kernel with copy_file_range or sendfile, falling back to a buffered copy. A target
+// whose size and mtime match its source is left alone, copies carry the source mtime for that check.
+class FileCopyEngine final {
+public:
+    // Returns true when the entry of that name is copied, applied at every level of the tree.
+    using NameFilter = std::function<bool(const char* name)>;
+
+    static bool CopyFile(const std::string& source, const std::string& target);
+    // Creates the directories of the tree first, then copies the files on a bounded number of workers.
+    static bool CopyDir(const std::string& source, const std::string& target, const NameFilter& filter = nullptr);
+    // Writes an in-memory asset unless the target already has that size and is newer than notBefore.
+    static bool WriteBuffer(const uint8_t* data, size_t size, const std::string& target, time_t notBefore);
+
+private:
+    FileCopyEngine() = delete;
+    ~FileCopyEngine() = delete;
+};
+} // namespace Platform
+} // namespace AbilityRuntime
+} // namespace OHOS
+#endif // FOUNDATION_ACE_ADAPTER_ANDROID_STAGE_ABILITY_JAVA_JNI_FILE_COPY_ENGINE_H
@@ -19,7 +19,11 @@
 #include "app_main.h"
 #include "application_context_adapter.h"
 #include "foundation/arkui/ace_engine/adapter/android/entrance/java/jni/apk_asset_provider.h"
+#include "foundation/arkui/ace_engine/adapter/android/osal/dynamic_module_preloader.h"
 #include "foundation/arkui/ace_engine/adapter/android/osal/high_contrast_observer.h"
+#include "foundation/arkui/ace_engine/adapter/android/osal/perf_event_sink.h"
+#include "foundation/arkui/ace_engine/adapter/android/osal/startup_profiler.h"
+#include "foundation/arkui/ace_engine/adapter/android/osal/theme_snapshot.h"
 #include "stage_application_info_adapter.h"
 #include "stage_asset_provider.h"
 
@@ -32,6 +36,9 @@ namespace AbilityRuntime {
 namespace Platform {
 namespace {
 OHOS::Ace::LogLevel g_currentLogLevel = OHOS::Ace::LogLevel::ERROR;
+const std::string PERF_EVENT_DIR = "/arkui_perf";
+const std::string DYNAMIC_MODULE_PROFILE = "/arkui_dynamic_modules";
+const std::string THEME_SNAPSHOT_DIR = "/arkui_theme";
 } // namespace
 bool StageApplicationDelegateJni::Register(const std::shared_ptr<JNIEnv>& env)
 {
@@ -147,6 +154,11 @@ bool StageApplicationDelegateJni::Register(const std::shared_ptr<JNIEnv>& env)
             .signature = "(Ljava/lang/String;Ljava/lang/String;)V",
             .fnPtr = reinterpret_cast<void*>(&LoadModule),
         },
+        {
+            .name = "nativePrefetchModules",
+            .signature = "([Ljava/lang/String;)V",
+            .fnPtr = reinterpret_cast<void*>(&PrefetchModules),
+        },
         {
             .name = "nativeOnHighContrastChanged",
             .signature = "(Z)V",
@@ -195,6 +207,7 @@ void StageApplicationDelegateJni::SetHapPath(JNIEnv* env, jclass myclass, jstrin
     }
     auto hapPath = env->GetStringUTFChars(str, nullptr);
     if (hapPath != nullptr) {
+        Ace::StartupPhaseScope startupPhase(Ace::StartupPhase::HAP_PATH);
         StageAssetProvider::GetInstance()->SetAppPath(hapPath);
         env->ReleaseStringUTFChars(str, hapPath);
     }
@@ -243,6 +256,7 @@ void StageApplicationDelegateJni::SetCacheDir(JNIEnv* env, jclass myclass, jstri
     auto cacheDir = env->GetStringUTFChars(str, nullptr);
     if (cacheDir != nullptr) {
         StageAssetProvider::GetInstance()->SetCacheDir(cacheDir);
+        Ace::ThemeSnapshot::GetInstance().SetCacheDir(std::string(cacheDir) + THEME_SNAPSHOT_DIR);
         env->ReleaseStringUTFChars(str, cacheDir);
     }
 }
@@ -256,6 +270,8 @@ void StageApplicationDelegateJni::SetFileDir(JNIEnv* env, jclass myclass, jstrin
     auto filesDir = env->GetStringUTFChars(str, nullptr);
     if (filesDir != nullptr) {
         StageAssetProvider::GetInstance()->SetFileDir(filesDir);
+        Ace::PerfEventSink::GetInstance().SetDataDir(std::string(filesDir) + PERF_EVENT_DIR);
+        Ace::DynamicModulePreloader::GetInstance().SetProfilePath(std::string(filesDir) + DYNAMIC_MODULE_PROFILE);
         env->ReleaseStringUTFChars(str, filesDir);
     }
 }
@@ -408,6 +424,8 @@ void StageApplicationDelegateJni::DispatchApplicationOnForeground(JNIEnv* env, j
 void StageApplicationDelegateJni::DispatchApplicationOnBackground(JNIEnv* env, jclass myclass)
 {
     AppMain::GetInstance()->NotifyApplicationBackground();
+    Ace::PerfEventSink::GetInstance().Flush();
+    Ace::DynamicModulePreloader::GetInstance().Flush();
 }
 
 void StageApplicationDelegateJni::PreloadModule(JNIEnv* env, jclass myclass, jstring jModuleName, jstring jAbilityName)
@@ -423,7 +441,12 @@ void StageApplicationDelegateJni::PreloadModule(JNIEnv* env, jclass myclass, jst
         return;
     }
 
-    AppMain::GetInstance()->PreloadModule(moduleName, abilityName);
+    {
+        Ace::StartupPhaseScope startupPhase(Ace::StartupPhase::MODULE_PRELOAD);
+        // The shared modules it depends on are read in the background while the module itself loads.
+        StageAssetProvider::GetInstance()->PrefetchModules({ moduleName });
+        AppMain::GetInstance()->PreloadModule(moduleName, abilityName);
+    }
     env->ReleaseStringUTFChars(jModuleName, moduleName);
     env->ReleaseStringUTFChars(jAbilityName, abilityName);
 }
@@ -449,11 +472,39 @@ void StageApplicationDelegateJni::LoadModule(
         return;
     }
 
-    AppMain::GetInstance()->LoadModule(moduleName, entryFile);
+    {
+        Ace::StartupPhaseScope startupPhase(Ace::StartupPhase::MODULE_LOAD);
+        AppMain::GetInstance()->LoadModule(moduleName, entryFile);
+    }
     env->ReleaseStringUTFChars(jModuleName, moduleName);
     env->ReleaseStringUTFChars(jEntryFile, entryFile);
 }
 
+void StageApplicationDelegateJni::PrefetchModules(JNIEnv* env, jclass myclass, jobjectArray jModuleNames)
+{
+    if (env == nullptr || jModuleNames == nullptr) {
+        LOGE("PrefetchModules env or moduleNames is nullptr");
+        return;
+    }
+    std::vector<std::string> moduleNames;
+    jsize count = env->GetArrayLength(jModuleNames);
+    for (jsize index = 0; index < count; ++index) {
+        auto jModuleName = static_cast<jstring>(env->GetObjectArrayElement(jModuleNames, index));
+        if (jModuleName == nullptr) {
+            continue;
+        }
+        auto moduleName = env->GetStringUTFChars(jModuleName, nullptr);
+        if (moduleName != nullptr) {
+            moduleNames.emplace_back(moduleName);
+            env->ReleaseStringUTFChars(jModuleName, moduleName);
+        }
+        env->DeleteLocalRef(jModuleName);
+    }
+    if (!moduleNames.empty()) {
+        StageAssetProvider::GetInstance()->PrefetchModules(moduleNames);
+    }
+}
+
 void StageApplicationDelegateJni::OnHighContrastChanged(JNIEnv* env, jclass myclass, jboolean isEnabled)
 {
     CHECK_NULL_VOID(env);
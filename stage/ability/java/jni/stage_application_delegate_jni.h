@@ -52,6 +52,7 @@ public:
     static void DispatchApplicationOnBackground(JNIEnv* env, jclass myclass);
     static void PreloadModule(JNIEnv* env, jclass myclass, jstring jModuleName, jstring jAbilityName);
     static void LoadModule(JNIEnv* env, jclass myclass, jstring jModuleName, jstring jEntryFile);
+    static void PrefetchModules(JNIEnv* env, jclass myclass, jobjectArray jModuleNames);
     static void OnHighContrastChanged(JNIEnv* env, jclass myclass, jboolean isEnabled);
     static OHOS::Ace::LogLevel GetCurrentLogLevel();
 };
@@ -0,0 +1,199 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "stage_asset_index.h"
+
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "base/log/log.h"
+
+namespace OHOS {
+namespace AbilityRuntime {
+namespace Platform {
+namespace {
+constexpr char INDEX_MAGIC[] = { 'S', 'A', 'I', 'X' };
+constexpr uint32_t INDEX_VERSION = 1;
+constexpr uint64_t FNV_OFFSET_BASIS = 14695981039346656037ULL;
+constexpr uint64_t FNV_PRIME = 1099511628211ULL;
+constexpr size_t MAX_INDEX_SIZE = 1024 * 1024;
+const std::string INDEX_TMP_POSTFIX = ".tmp";
+
+std::string GetStatKey(const std::string& path)
+{
+    struct stat fileStat {};
+    if (stat(path.c_str(), &fileStat) != 0) {
+        return "-";
+    }
+    return std::to_string(fileStat.st_size) + "." + std::to_string(fileStat.st_mtim.tv_sec) + "." +
+           std::to_string(fileStat.st_mtim.tv_nsec);
+}
+
+class IndexReader final {
+public:
+    IndexReader(const uint8_t* data, size_t size) : data_(data), size_(size) {}
+
+    template<typename T>
+    bool ReadValue(T& value)
+    {
+        if (size_ - offset_ < sizeof(T)) {
+            return false;
+        }
+        memcpy(&value, data_ + offset_, sizeof(T));
+        offset_ += sizeof(T);
+        return true;
+    }
+
+    bool ReadString(std::string& value)
+    {
+        uint32_t length = 0;
+        if (!ReadValue(length) || size_ - offset_ < length) {
+            return false;
+        }
+        value.assign(reinterpret_cast<const char*>(data_ + offset_), length);
+        offset_ += length;
+        return true;
+    }
+
+    bool IsEnd() const
+    {
+        return offset_ == size_;
+    }
+
+private:
+    const uint8_t* data_;
+    size_t size_;
+    size_t offset_ = 0;
+};
+
+template<typename T>
+void AppendValue(std::vector<uint8_t>& buffer, T value)
+{
+    auto* bytes = reinterpret_cast<const uint8_t*>(&value);
+    buffer.insert(buffer.end(), bytes, bytes + sizeof(T));
+}
+
+void AppendString(std::vector<uint8_t>& buffer, const std::string& value)
+{
+    AppendValue(buffer, static_cast<uint32_t>(value.size()));
+    buffer.insert(buffer.end(), value.begin(), value.end());
+}
+
+bool ParseIndex(const uint8_t* data, size_t size, const std::string& key,
+    std::unordered_map<std::string, int32_t>& versionCodes)
+{
+    IndexReader reader(data, size);
+    char magic[sizeof(INDEX_MAGIC)] = { 0 };
+    uint32_t version = 0;
+    std::string fileKey;
+    uint32_t count = 0;
+    if (!reader.ReadValue(magic) || memcmp(magic, INDEX_MAGIC, sizeof(magic)) != 0 || !reader.ReadValue(version) ||
+        version != INDEX_VERSION || !reader.ReadString(fileKey) || fileKey != key || !reader.ReadValue(count)) {
+        return false;
+    }
+    std::unordered_map<std::string, int32_t> entries;
+    for (uint32_t index = 0; index < count; ++index) {
+        std::string name;
+        int32_t versionCode = 0;
+        if (!reader.ReadString(name) || !reader.ReadValue(versionCode)) {
+            return false;
+        }
+        entries.emplace(std::move(name), versionCode);
+    }
+    if (!reader.IsEnd()) {
+        return false;
+    }
+    for (auto& [name, versionCode] : entries) {
+        versionCodes.emplace(name, versionCode);
+    }
+    return true;
+}
+} // namespace
+
+std::string StageAssetIndex::MakeKey(
+    const std::string& appPath, const std::string& appDataModuleDir, const std::vector<std::string>& assetPaths)
+{
+    uint64_t hash = FNV_OFFSET_BASIS;
+    for (const auto& path : assetPaths) {
+        for (auto ch : path) {
+            hash = (hash ^ static_cast<uint8_t>(ch)) * FNV_PRIME;
+        }
+        hash = (hash ^ static_cast<uint8_t>(';')) * FNV_PRIME;
+    }
+    // Adding or removing a module directory changes the mtime of the app data module dir.
+    return appPath + ":" + GetStatKey(appPath) + ":" + GetStatKey(appDataModuleDir) + ":" +
+           std::to_string(assetPaths.size()) + "." + std::to_string(hash);
+}
+
+bool StageAssetIndex::Read(
+    const std::string& indexPath, const std::string& key, std::unordered_map<std::string, int32_t>& versionCodes)
+{
+    int fd = open(indexPath.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        return false;
+    }
+    struct stat fileStat {};
+    if (fstat(fd, &fileStat) != 0 || fileStat.st_size <= 0 || static_cast<size_t>(fileStat.st_size) > MAX_INDEX_SIZE) {
+        close(fd);
+        return false;
+    }
+    auto size = static_cast<size_t>(fileStat.st_size);
+    void* data = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (data == MAP_FAILED) {
+        LOGW("Map asset index failed, errno: %{public}d", errno);
+        return false;
+    }
+    bool ret = ParseIndex(static_cast<const uint8_t*>(data), size, key, versionCodes);
+    munmap(data, size);
+    return ret;
+}
+
+bool StageAssetIndex::Write(const std::string& indexPath, const std::string& key,
+    const std::unordered_map<std::string, int32_t>& versionCodes)
+{
+    std::vector<uint8_t> buffer;
+    buffer.insert(buffer.end(), INDEX_MAGIC, INDEX_MAGIC + sizeof(INDEX_MAGIC));
+    AppendValue(buffer, INDEX_VERSION);
+    AppendString(buffer, key);
+    AppendValue(buffer, static_cast<uint32_t>(versionCodes.size()));
+    for (const auto& [name, versionCode] : versionCodes) {
+        AppendString(buffer, name);
+        AppendValue(buffer, versionCode);
+    }
+
+    std::string tmpPath = indexPath + INDEX_TMP_POSTFIX;
+    std::FILE* fp = std::fopen(tmpPath.c_str(), "wb");
+    if (fp == nullptr) {
+        LOGW("Open asset index %{public}s failed, errno: %{public}d", tmpPath.c_str(), errno);
+        return false;
+    }
+    bool ret = std::fwrite(buffer.data(), 1, buffer.size(), fp) == buffer.size();
+    ret = (std::fclose(fp) == 0) && ret;
+    if (!ret || std::rename(tmpPath.c_str(), indexPath.c_str()) != 0) {
+        LOGW("Write asset index %{public}s failed, errno: %{public}d", indexPath.c_str(), errno);
+        std::remove(tmpPath.c_str());
+        return false;
+    }
+    return true;
+}
+} // namespace Platform
+} // namespace AbilityRuntime
+} // namespace OHOS
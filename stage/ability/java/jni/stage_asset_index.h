@@ -0,0 +1,49 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FOUNDATION_ACE_ADAPTER_ANDROID_STAGE_ABILITY_JAVA_JNI_STAGE_ASSET_INDEX_H
+#define FOUNDATION_ACE_ADAPTER_ANDROID_STAGE_ABILITY_JAVA_JNI_STAGE_ASSET_INDEX_H
+
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace OHOS {
+namespace AbilityRuntime {
+namespace Platform {
+// On-disk cache of the module version codes StageAssetProvider reads from every module.json of the apk. The file
+// is only used while its key matches, which covers the apk, the asset list and the module directories in app data.
+//
+// Layout, native endian: magic "SAIX", uint32 version, uint32 key size, key, uint32 entry count, then per entry
+// uint32 name size, name, int32 version code.
+class StageAssetIndex final {
+public:
+    static std::string MakeKey(
+        const std::string& appPath, const std::string& appDataModuleDir, const std::vector<std::string>& assetPaths);
+    // The file is memory-mapped while it is parsed.
+    static bool Read(
+        const std::string& indexPath, const std::string& key, std::unordered_map<std::string, int32_t>& versionCodes);
+    static bool Write(const std::string& indexPath, const std::string& key,
+        const std::unordered_map<std::string, int32_t>& versionCodes);
+
+private:
+    StageAssetIndex() = delete;
+    ~StageAssetIndex() = delete;
+};
+} // namespace Platform
+} // namespace AbilityRuntime
+} // namespace OHOS
+#endif // FOUNDATION_ACE_ADAPTER_ANDROID_STAGE_ABILITY_JAVA_JNI_STAGE_ASSET_INDEX_H
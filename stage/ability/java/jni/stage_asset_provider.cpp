@@ -15,20 +15,29 @@
 
 #include "stage_asset_provider.h"
 
+#include <cerrno>
+#include <chrono>
 #include <cstdio>
 #include <dirent.h>
-#include <fstream>
+#include <fcntl.h>
 #include <iostream>
+#include <limits>
 #include <string.h>
+#include <sys/mman.h>
 #include <sys/stat.h>
 #include <sys/types.h>
 #include <unistd.h>
+#include <unordered_set>
 
+#include "adapter/android/osal/file_asset_provider.h"
 #include "base/log/log.h"
+#include "base/thread/background_task_executor.h"
 #include "base/utils/string_utils.h"
+#include "file_copy_engine.h"
 #include "include/core/SkFontMgr.h"
 #include "native_module_manager.h"
 #include "nlohmann/json.hpp"
+#include "stage_asset_index.h"
 
 using Json = nlohmann::json;
 
@@ -60,6 +69,52 @@ const std::string SYSTEM_FONT_DIR = "fonts";
 const std::string BASE_DIR = "/base";
 const std::string PROFILE_DIR = "/profile";
 const std::string RESFILE_DIR = "/resfile";
+const std::string ASSET_INDEX_NAME = "/arkui_asset_index";
+// Files of at least this size are mapped instead of read by GetMappingByAppDataPath, FOO_MAX_LEN does not apply.
+constexpr size_t MMAP_THRESHOLD = 256 * 1024;
+// A load waits this long for a prefetch still in progress before reading the file itself.
+constexpr std::chrono::milliseconds PREFETCH_WAIT_TIMEOUT(2000);
+// Prefetched buffers no load took within this time are released.
+constexpr std::chrono::seconds PREFETCH_EXPIRE_TIME(10);
+
+class MappedFileAssetMapping : public Ace::AssetMapping {
+public:
+    MappedFileAssetMapping(void* data, size_t size) : data_(data), size_(size) {}
+    ~MappedFileAssetMapping() override
+    {
+        munmap(data_, size_);
+    }
+
+    size_t GetSize() const override
+    {
+        return size_;
+    }
+
+    const uint8_t* GetAsset() const override
+    {
+        return static_cast<const uint8_t*>(data_);
+    }
+
+private:
+    void* data_ = nullptr;
+    size_t size_ = 0;
+};
+
+bool ReadFully(int fd, uint8_t* data, size_t size)
+{
+    size_t offset = 0;
+    while (offset < size) {
+        ssize_t bytes = pread(fd, data + offset, size - offset, static_cast<off_t>(offset));
+        if (bytes < 0 && errno == EINTR) {
+            continue;
+        }
+        if (bytes <= 0) {
+            return false;
+        }
+        offset += static_cast<size_t>(bytes);
+    }
+    return true;
+}
 } // namespace
 std::shared_ptr<StageAssetProvider> StageAssetProvider::instance_ = nullptr;
 std::mutex StageAssetProvider::mutex_;
@@ -307,6 +362,8 @@ std::vector<uint8_t> StageAssetProvider::GetModuleBuffer(
     }
 
     std::vector<uint8_t> buffer;
+    // Shared modules prefetched as dependencies are taken here, the resource copy below still runs.
+    auto prefetched = esmodule && TakePrefetchedModule(moduleName, modulePath, buffer);
     auto dynamicLoadFlag = true;
     std::string moduleNameMark = SEPARATOR + moduleName + SEPARATOR;
 
@@ -326,11 +383,13 @@ std::vector<uint8_t> StageAssetProvider::GetModuleBuffer(
     if (dynamicLoadFlag) {
         auto path = GetAppDataModuleDir() + SEPARATOR + moduleName;
         std::vector<std::string> fileFullPaths;
-        GetAppDataModuleAssetList(path, fileFullPaths, false);
+        if (!prefetched) {
+            GetAppDataModuleAssetList(path, fileFullPaths, false);
+        }
         for (auto& path : fileFullPaths) {
             if (path.find(moduleNameMark) != std::string::npos && path.find(fullAbilityName) != std::string::npos) {
                 modulePath = path;
-                buffer = GetBufferByAppDataPath(path);
+                buffer = GetAbcBufferByAppDataPath(path);
                 break;
             }
         }
@@ -340,6 +399,8 @@ std::vector<uint8_t> StageAssetProvider::GetModuleBuffer(
         if (ExistDir(path) && !ExistDir(resourceDescDir)) {
             MakeDir(resourceDescDir);
             CopyDir(path, resourceDescDir);
+            // The module was just installed, paths probed before it arrived are cached as missing.
+            Ace::FileAssetProvider::InvalidateAllCaches();
         }
         auto downloadPath = GetAppDataModuleDir() + SEPARATOR + SYSTEM_RES_INDEX_NAME;
         auto systemresDescDir = resourcesFilePrefixPath_ + SEPARATOR + SYSTEM_RES_INDEX_NAME;
@@ -347,7 +408,7 @@ std::vector<uint8_t> StageAssetProvider::GetModuleBuffer(
             MakeDir(systemresDescDir);
             CopyDir(downloadPath, systemresDescDir);
         }
-    } else {
+    } else if (!prefetched) {
         for (auto& path : abcPath) {
             if (path.find(moduleNameMark) != std::string::npos) {
                 modulePath = path;
@@ -375,6 +436,163 @@ std::vector<uint8_t> StageAssetProvider::GetModuleBuffer(
 
 std::vector<uint8_t> StageAssetProvider::GetModuleAbilityBuffer(
     const std::string& moduleName, const std::string& abilityName, std::string& modulePath, bool esmodule)
+{
+    std::vector<uint8_t> buffer;
+    if (esmodule && TakePrefetchedModule(moduleName, modulePath, buffer)) {
+        return buffer;
+    }
+    return ReadModuleAbilityBuffer(moduleName, abilityName, modulePath, esmodule);
+}
+
+void StageAssetProvider::PrefetchModules(const std::vector<std::string>& moduleNames)
+{
+    // module.json files are small and parsed on the calling thread, only the abc reads go to the background.
+    std::vector<std::string> orderedModules;
+    std::unordered_set<std::string> visitedModules;
+    for (const auto& moduleName : moduleNames) {
+        CollectModulesInDependencyOrder(moduleName, visitedModules, orderedModules);
+    }
+
+    std::lock_guard<std::mutex> lock(prefetchMutex_);
+    PruneExpiredPrefetchesLocked();
+    // Dependencies are posted before the modules that need them, GetModuleBuffer takes the shared ones.
+    for (const auto& moduleName : orderedModules) {
+        if (prefetchingModules_.count(moduleName) > 0 || prefetchedModules_.count(moduleName) > 0) {
+            continue;
+        }
+        auto token = ++prefetchToken_;
+        prefetchingModules_[moduleName] = token;
+        auto readTask = [moduleName, token]() {
+            auto provider = StageAssetProvider::GetInstance();
+            std::string modulePath;
+            auto buffer = provider->ReadModuleAbilityBuffer(moduleName, "", modulePath, true);
+            provider->FinishPrefetch(moduleName, token, std::move(modulePath), std::move(buffer));
+        };
+        if (!Ace::BackgroundTaskExecutor::GetInstance().PostTask(readTask)) {
+            prefetchingModules_.erase(moduleName);
+        }
+    }
+}
+
+void StageAssetProvider::CollectModulesInDependencyOrder(const std::string& moduleName,
+    std::unordered_set<std::string>& visitedModules, std::vector<std::string>& orderedModules)
+{
+    if (moduleName.empty() || !visitedModules.insert(moduleName).second) {
+        return;
+    }
+    for (const auto& dependency : GetModuleDependencies(moduleName)) {
+        CollectModulesInDependencyOrder(dependency, visitedModules, orderedModules);
+    }
+    orderedModules.emplace_back(moduleName);
+}
+
+std::vector<uint8_t> StageAssetProvider::GetModuleJsonBuffer(const std::string& moduleName)
+{
+    std::string foundPath;
+    const std::string foundKey = SEPARATOR + moduleName + SEPARATOR + MODULE_JSON_NAME;
+    {
+        std::lock_guard<std::mutex> lock(allFilePathMutex_);
+        for (auto& path : allFilePath_) {
+            if (path.find(foundKey) != std::string::npos) {
+                foundPath = path;
+                break;
+            }
+        }
+    }
+    if (foundPath.empty()) {
+        return GetBufferByAppDataPath(GetAppDataModuleDir() + SEPARATOR + moduleName + SEPARATOR + MODULE_JSON_NAME);
+    }
+    auto lastPos = foundPath.find_last_of('/');
+    auto assetProvider = CreateAndFindAssetProvider(foundPath.substr(0, lastPos));
+    if (!assetProvider) {
+        return {};
+    }
+    auto mapping = assetProvider->GetAsMapping(foundPath.substr(lastPos + 1));
+    if (mapping == nullptr || mapping->GetAsset() == nullptr) {
+        return {};
+    }
+    return std::vector<uint8_t>(mapping->GetAsset(), mapping->GetAsset() + mapping->GetSize());
+}
+
+std::vector<std::string> StageAssetProvider::GetModuleDependencies(const std::string& moduleName)
+{
+    std::vector<std::string> dependencies;
+    auto moduleJsonBuffer = GetModuleJsonBuffer(moduleName);
+    if (moduleJsonBuffer.empty()) {
+        return dependencies;
+    }
+    Json moduleJson = Json::parse(moduleJsonBuffer.begin(), moduleJsonBuffer.end(), nullptr, false);
+    if (moduleJson.is_discarded() || !moduleJson.contains("module") ||
+        !moduleJson["module"].contains("dependencies") || !moduleJson["module"]["dependencies"].is_array()) {
+        return dependencies;
+    }
+    for (const auto& dependency : moduleJson["module"]["dependencies"]) {
+        if (dependency.contains("moduleName") && dependency["moduleName"].is_string()) {
+            dependencies.emplace_back(dependency["moduleName"].get<std::string>());
+        }
+    }
+    return dependencies;
+}
+
+void StageAssetProvider::FinishPrefetch(
+    const std::string& moduleName, uint64_t token, std::string modulePath, std::vector<uint8_t> buffer)
+{
+    std::lock_guard<std::mutex> lock(prefetchMutex_);
+    auto iter = prefetchingModules_.find(moduleName);
+    // A waiter that timed out or a module update dropped the read, its result is not used.
+    if (iter == prefetchingModules_.end() || iter->second != token) {
+        return;
+    }
+    prefetchingModules_.erase(iter);
+    PruneExpiredPrefetchesLocked();
+    if (!buffer.empty()) {
+        prefetchedModules_[moduleName] = { std::move(modulePath), std::move(buffer),
+            std::chrono::steady_clock::now() + PREFETCH_EXPIRE_TIME };
+    }
+    prefetchCondition_.notify_all();
+}
+
+bool StageAssetProvider::TakePrefetchedModule(
+    const std::string& moduleName, std::string& modulePath, std::vector<uint8_t>& buffer)
+{
+    std::unique_lock<std::mutex> lock(prefetchMutex_);
+    auto isReadDone = [this, &moduleName]() { return prefetchingModules_.count(moduleName) == 0; };
+    if (!prefetchCondition_.wait_for(lock, PREFETCH_WAIT_TIMEOUT, isReadDone)) {
+        LOGW("Prefetch of module %{public}s timed out, read it directly", moduleName.c_str());
+        prefetchingModules_.erase(moduleName);
+        prefetchCondition_.notify_all();
+        return false;
+    }
+    PruneExpiredPrefetchesLocked();
+    auto iter = prefetchedModules_.find(moduleName);
+    if (iter == prefetchedModules_.end()) {
+        return false;
+    }
+    modulePath = std::move(iter->second.modulePath);
+    buffer = std::move(iter->second.buffer);
+    prefetchedModules_.erase(iter);
+    return true;
+}
+
+void StageAssetProvider::PruneExpiredPrefetchesLocked()
+{
+    auto now = std::chrono::steady_clock::now();
+    for (auto iter = prefetchedModules_.begin(); iter != prefetchedModules_.end();) {
+        iter = (iter->second.expireTime <= now) ? prefetchedModules_.erase(iter) : std::next(iter);
+    }
+}
+
+void StageAssetProvider::DropPrefetchedModule(const std::string& moduleName)
+{
+    std::lock_guard<std::mutex> lock(prefetchMutex_);
+    prefetchedModules_.erase(moduleName);
+    if (prefetchingModules_.erase(moduleName) > 0) {
+        prefetchCondition_.notify_all();
+    }
+}
+
+std::vector<uint8_t> StageAssetProvider::ReadModuleAbilityBuffer(
+    const std::string& moduleName, const std::string& abilityName, std::string& modulePath, bool esmodule)
 {
     LOGI("Get Module Ability Buffer");
     std::string fullAbilityName;
@@ -408,7 +626,7 @@ std::vector<uint8_t> StageAssetProvider::GetModuleAbilityBuffer(
         for (auto& path : fileFullPaths) {
             if (path.find(moduleNameMark) != std::string::npos && path.find(fullAbilityName) != std::string::npos) {
                 modulePath = path;
-                buffer = GetBufferByAppDataPath(path);
+                buffer = GetAbcBufferByAppDataPath(path);
                 break;
             }
         }
@@ -498,6 +716,8 @@ void StageAssetProvider::SetFileDir(const std::string& filesRootDir)
     preferenceDir_ = filesRootDir + PREFERENCE_DIR;
     databaseDir_ = filesRootDir + DATABASE_DIR;
     arkuiXSandboxDir_ = filesRootDir + ARKUI_X_DIR;
+    // Kept outside the sandbox dir, whose mtime is part of the index key.
+    assetIndexPath_ = filesRootDir + ASSET_INDEX_NAME;
     size_t lastSlashPos = appLibDir_.find_last_of('/');
     if (lastSlashPos != std::string::npos) {
         if (appLibDir_.substr(lastSlashPos) == "/arm64") {
@@ -643,77 +863,73 @@ bool StageAssetProvider::GetAppDataModuleAssetList(
 std::vector<uint8_t> StageAssetProvider::GetBufferByAppDataPath(const std::string& fileFullPath)
 {
     std::vector<uint8_t> buffer;
-    std::lock_guard<std::mutex> lock(allFilePathMutex_);
-    std::FILE* fp = std::fopen(fileFullPath.c_str(), "r");
-    if (fp == nullptr) {
-        return buffer;
-    }
-
-    if (std::fseek(fp, 0, SEEK_END) != 0) {
-        LOGE("seek file tail error");
-        std::fclose(fp);
+    int fd = open(fileFullPath.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
         return buffer;
     }
-
-    int64_t size = std::ftell(fp);
-    if (size == -1L || size == 0L || size > FOO_MAX_LEN) {
+    struct stat fileStat {};
+    if (fstat(fd, &fileStat) != 0 || fileStat.st_size <= 0 || fileStat.st_size > FOO_MAX_LEN) {
         LOGE("tell file error");
-        std::fclose(fp);
+        close(fd);
         return buffer;
     }
-    uint8_t* dataArray = new (std::nothrow) uint8_t[size];
-    if (dataArray == nullptr) {
-        LOGE("new uint8_t array failed");
-        std::fclose(fp);
-        return buffer;
+    auto size = static_cast<size_t>(fileStat.st_size);
+    buffer.resize(size);
+    if (!ReadFully(fd, buffer.data(), size)) {
+        LOGE("read file failed");
+        buffer.clear();
     }
+    close(fd);
+    return buffer;
+}
 
-    rewind(fp);
-    std::unique_ptr<uint8_t[]> data(dataArray);
-    size_t result = std::fread(data.get(), 1, size, fp);
-    if (result != (size_t)size) {
+std::unique_ptr<Ace::AssetMapping> StageAssetProvider::GetMappingByAppDataPath(const std::string& fileFullPath)
+{
+    int fd = open(fileFullPath.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        return nullptr;
+    }
+    struct stat fileStat {};
+    if (fstat(fd, &fileStat) != 0 || fileStat.st_size <= 0) {
+        close(fd);
+        return nullptr;
+    }
+    auto size = static_cast<size_t>(fileStat.st_size);
+    std::unique_ptr<Ace::AssetMapping> mapping;
+    if (size >= MMAP_THRESHOLD) {
+        void* data = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (data != MAP_FAILED) {
+            madvise(data, size, MADV_SEQUENTIAL);
+            mapping = std::make_unique<MappedFileAssetMapping>(data, size);
+        }
+    }
+    if (!mapping && size <= static_cast<size_t>(FOO_MAX_LEN)) {
+        std::unique_ptr<uint8_t[]> data(new (std::nothrow) uint8_t[size]);
+        if (data && ReadFully(fd, data.get(), size)) {
+            mapping = std::make_unique<FileAssetMapping>(std::move(data), size);
+        }
+    }
+    close(fd);
+    if (!mapping) {
         LOGE("read file failed");
-        std::fclose(fp);
-        return buffer;
     }
+    return mapping;
+}
 
-    std::fclose(fp);
-    auto mapping = std::make_unique<FileAssetMapping>(std::move(data), size);
-    if (mapping == nullptr) {
-        LOGE("mapping is nullptr");
-        return buffer;
-    }
-    auto moduleMap = mapping->GetAsset();
-    if (moduleMap == nullptr) {
-        LOGE("moduleMap is nullptr");
-        return buffer;
+std::vector<uint8_t> StageAssetProvider::GetAbcBufferByAppDataPath(const std::string& fileFullPath)
+{
+    // A large abc is paged in from the mapping, without the FOO_MAX_LEN limit of a plain read.
+    std::vector<uint8_t> buffer;
+    auto mapping = GetMappingByAppDataPath(fileFullPath);
+    if (mapping != nullptr) {
+        buffer.assign(mapping->GetAsset(), mapping->GetAsset() + mapping->GetSize());
     }
-    buffer.assign(&moduleMap[0], &moduleMap[mapping->GetSize()]);
     return buffer;
 }
 
 bool StageAssetProvider::CopyFile(std::string sourceFile, std::string newFile)
 {
-    std::ifstream in;
-    std::ofstream out;
-    in.open(sourceFile.c_str(), std::ios::binary);
-    if (in.fail()) {
-        LOGE("open sourcefile error!");
-        in.close();
-        out.close();
-        return false;
-    }
-    out.open(newFile.c_str(), std::ios::binary);
-    if (out.fail()) {
-        LOGE("new file error!");
-        out.close();
-        in.close();
-        return false;
-    }
-    out << in.rdbuf();
-    out.close();
-    in.close();
-    return true;
+    return FileCopyEngine::CopyFile(sourceFile, newFile);
 }
 
 bool StageAssetProvider::ExistDir(std::string target)
@@ -741,40 +957,10 @@ bool StageAssetProvider::MakeDir(std::string target)
 
 bool StageAssetProvider::CopyDir(std::string source, const std::string& target)
 {
-    DIR* dir = nullptr;
-    struct stat st;
-    struct dirent* dp = nullptr;
-
-    if (stat(source.c_str(), &st) < 0 || !S_ISDIR(st.st_mode)) {
-        LOGE("source is null!");
-        return false;
-    }
-
-    if (!(dir = opendir(source.c_str()))) {
-        LOGE("source dir open error!");
-        return false;
-    }
-
-    while ((dp = readdir(dir)) != nullptr) {
-        if ((!strncmp(dp->d_name, ".", 1)) || (!strncmp(dp->d_name, ".", 2))) {
-            continue;
-        }
-        if (!strncmp(dp->d_name, "ets", 3) || !strncmp(dp->d_name, "module.json", 12)) {
-            continue;
-        }
-        std::string newpath = source + SEPARATOR + dp->d_name;
-        stat(newpath.c_str(), &st);
-        std::string newtarget = target + SEPARATOR + dp->d_name;
-
-        if (S_ISDIR(st.st_mode)) {
-            MakeDir(newtarget);
-            CopyDir(newpath, newtarget);
-        } else {
-            CopyFile(newpath, newtarget);
-        }
-    }
-    closedir(dir);
-    return true;
+    return FileCopyEngine::CopyDir(source, target, [](const char* name) {
+        return strncmp(name, ".", 1) != 0 && strncmp(name, "ets", 3) != 0 &&
+               strcmp(name, MODULE_JSON_NAME.c_str()) != 0;
+    });
 }
 
 void StageAssetProvider::CopyHspResourcePath(const std::string& moduleName)
@@ -812,20 +998,6 @@ bool StageAssetProvider::MakeMultipleDir(const std::string& path)
     return MakeMultipleDir(filePath) ? MakeDir(path) : false;
 }
 
-bool StageAssetProvider::CopyBufferToFile(std::vector<uint8_t>& buffer, const std::string& newFile)
-{
-    std::ofstream out;
-    out.open(newFile.c_str(), std::ios::binary);
-    if (out.fail()) {
-        LOGE("new file error!");
-        out.close();
-        return false;
-    }
-    out.write(reinterpret_cast<char*>(buffer.data()), buffer.size());
-    out.close();
-    return true;
-}
-
 void StageAssetProvider::CopyNativeLibToAppDataModuleDir(const std::string& bundleName)
 {
     std::vector<std::string> libPaths;
@@ -834,6 +1006,10 @@ void StageAssetProvider::CopyNativeLibToAppDataModuleDir(const std::string& bund
             libPaths.emplace_back(path);
         }
     }
+    // A library extracted after the apk was installed is up to date when its size still matches.
+    struct stat appStat {};
+    time_t appInstallTime = stat(appPath_.c_str(), &appStat) == 0 ? appStat.st_mtim.tv_sec
+                                                                   : std::numeric_limits<time_t>::max();
 
     for (auto& path : libPaths) {
         auto lastPos = path.find_last_of(SEPARATOR);
@@ -851,9 +1027,6 @@ void StageAssetProvider::CopyNativeLibToAppDataModuleDir(const std::string& bund
             LOGE("moduleMap is nullptr");
             continue;
         }
-        std::vector<uint8_t> buffer;
-        buffer.assign(&moduleMap[0], &moduleMap[mapping->GetSize()]);
-
         auto beginPos = filePath.find(ARKUI_X_DIR);
         auto endPath = filePath.substr(beginPos + ARKUI_X_DIR.length() + 1, filePath.size() - 1);
         auto endPos = endPath.find_first_of(SEPARATOR);
@@ -866,7 +1039,7 @@ void StageAssetProvider::CopyNativeLibToAppDataModuleDir(const std::string& bund
         }
 
         auto newFile = newLibDir + SEPARATOR + fileName;
-        if (!CopyBufferToFile(buffer, newFile)) {
+        if (!FileCopyEngine::WriteBuffer(moduleMap, mapping->GetSize(), newFile, appInstallTime)) {
             LOGE("copy file failed");
             continue;
         }
@@ -1000,6 +1173,15 @@ std::string StageAssetProvider::GetSplicingModuleName(const std::string& moduleN
 
 void StageAssetProvider::InitModuleVersionCode()
 {
+    std::string indexKey;
+    if (!assetIndexPath_.empty()) {
+        std::lock_guard<std::mutex> lock(allFilePathMutex_);
+        indexKey = StageAssetIndex::MakeKey(appPath_, GetAppDataModuleDir(), allFilePath_);
+    }
+    if (!indexKey.empty() && StageAssetIndex::Read(assetIndexPath_, indexKey, versionCodes_)) {
+        LOGI("Module version codes loaded from asset index");
+        return;
+    }
     auto moduleList = GetModuleJsonBufferList();
     std::string moduleName = "";
     std::string bundleName = "";
@@ -1028,6 +1210,9 @@ void StageAssetProvider::InitModuleVersionCode()
             versionCodes_.emplace(moduleName, versionCode);
         }
     }
+    if (!indexKey.empty()) {
+        StageAssetIndex::Write(assetIndexPath_, indexKey, versionCodes_);
+    }
 }
 
 void StageAssetProvider::UpdateVersionCode(const std::string& moduleName, bool isNeedUpdate)
@@ -1051,6 +1236,10 @@ void StageAssetProvider::UpdateVersionCode(const std::string& moduleName, bool i
         }
     }
     moduleIsUpdates_[moduleName] = isUpdate;
+    if (isUpdate) {
+        Ace::FileAssetProvider::InvalidateAllCaches();
+        DropPrefetchedModule(moduleName);
+    }
 }
 
 bool StageAssetProvider::IsDynamicUpdateModule(const std::string& moduleName)
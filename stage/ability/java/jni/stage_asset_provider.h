@@ -16,11 +16,14 @@
 #ifndef FOUNDATION_ACE_ADAPTER_ANDROID_STAGE_ABILITY_JAVA_JNI_STAGE_ASSET_PROVIDER_H
 #define FOUNDATION_ACE_ADAPTER_ANDROID_STAGE_ABILITY_JAVA_JNI_STAGE_ASSET_PROVIDER_H
 
+#include <chrono>
+#include <condition_variable>
 #include <list>
 #include <map>
 #include <mutex>
 #include <string>
 #include <unordered_map>
+#include <unordered_set>
 #include <utility>
 #include "jni.h"
 #include "jni_environment.h"
@@ -107,6 +110,11 @@ public:
     std::vector<uint8_t> GetModuleBuffer(const std::string& moduleName, std::string& modulePath, bool esmodule);
     std::vector<uint8_t> GetModuleAbilityBuffer(
         const std::string& moduleName, const std::string& abilityName, std::string& modulePath, bool esmodule);
+    // Reads the modules.abc of the modules and of the modules they depend on on background threads, dependencies
+    // first. GetModuleAbilityBuffer and GetModuleBuffer of an esmodule take the buffer, or wait a bounded time for a
+    // read still in progress. Buffers not taken in time are released by the next prefetch or load, and the buffer of
+    // an updated module is dropped.
+    void PrefetchModules(const std::vector<std::string>& moduleNames);
     std::vector<uint8_t> GetAbcPathBuffer(const std::string& abcPath);
     Ace::RefPtr<AssetProvider> CreateAndFindAssetProvider(const std::string& path);
     void SetCacheDir(const std::string& filesRootDir);
@@ -129,7 +137,12 @@ public:
     std::string GetAppDataLibDir() const;
     bool GetAppDataModuleAssetList(const std::string& path, std::vector<std::string>& fileFullPaths, bool onlyChild);
     std::vector<std::string> GetAllFilePath();
+    // Reads the whole file straight into the result, files above FOO_MAX_LEN are not read.
     std::vector<uint8_t> GetBufferByAppDataPath(const std::string& fileFullPath);
+    // Maps large files instead of reading them, those are not limited to FOO_MAX_LEN.
+    std::unique_ptr<Ace::AssetMapping> GetMappingByAppDataPath(const std::string& fileFullPath);
+    // Module abc files, read through GetMappingByAppDataPath.
+    std::vector<uint8_t> GetAbcBufferByAppDataPath(const std::string& fileFullPath);
     std::pair<std::string, std::vector<uint8_t>> GetPkgPairByAppDataPath(const std::string& moduleName);
     bool CopyFile(std::string sourceFile, std::string newFile);
     bool ExistDir(std::string target);
@@ -150,12 +163,23 @@ public:
     std::vector<std::string> GetAllModuleDirectories();
 
 private:
+    std::vector<uint8_t> ReadModuleAbilityBuffer(
+        const std::string& moduleName, const std::string& abilityName, std::string& modulePath, bool esmodule);
+    bool TakePrefetchedModule(const std::string& moduleName, std::string& modulePath, std::vector<uint8_t>& buffer);
+    void FinishPrefetch(
+        const std::string& moduleName, uint64_t token, std::string modulePath, std::vector<uint8_t> buffer);
+    void DropPrefetchedModule(const std::string& moduleName);
+    void CollectModulesInDependencyOrder(const std::string& moduleName,
+        std::unordered_set<std::string>& visitedModules, std::vector<std::string>& orderedModules);
+    std::vector<uint8_t> GetModuleJsonBuffer(const std::string& moduleName);
+    std::vector<std::string> GetModuleDependencies(const std::string& moduleName);
+    // Called with prefetchMutex_ held.
+    void PruneExpiredPrefetchesLocked();
     std::vector<uint8_t> GetPkgJsonBufferFromAppData(const std::string& moduleName);
     std::vector<uint8_t> GetPkgJsonBufferFromAssets(const std::string& moduleName);
     bool ParseSharedModulePackageName(
         const std::string& moduleName, const std::vector<uint8_t>& moduleJsonBuffer, std::string& packageName);
     bool MakeMultipleDir(const std::string& path);
-    bool CopyBufferToFile(std::vector<uint8_t>& buffer, const std::string& newFile);
     bool IsDirectoryEmpty(const std::string& path) const;
     std::string appPath_;
     std::vector<std::string> allFilePath_;
@@ -173,11 +197,24 @@ private:
     std::string appDataLibDir_;
     std::string stubFilePath_;
     std::string arkuiXSandboxDir_;
+    std::string assetIndexPath_;
     std::string preferenceDir_;
     std::string resourcesFilePrefixPath_;
     std::string architecture_;
     std::string bundleName_;
     bool isDynamicLibs_ = false;
+    struct PrefetchedModule {
+        std::string modulePath;
+        std::vector<uint8_t> buffer;
+        std::chrono::steady_clock::time_point expireTime;
+    };
+    std::mutex prefetchMutex_;
+    std::condition_variable prefetchCondition_;
+    // Module name to the token of the read in progress, a read whose token was dropped discards its result.
+    std::unordered_map<std::string, uint64_t> prefetchingModules_;
+    uint64_t prefetchToken_ = 0;
+    // Module name to its modules.abc, each is taken once.
+    std::unordered_map<std::string, PrefetchedModule> prefetchedModules_;
     static std::shared_ptr<StageAssetProvider> instance_;
     static std::mutex mutex_;
 };
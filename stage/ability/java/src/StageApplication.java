@@ -85,6 +85,21 @@ public class StageApplication extends Application {
         StageApplicationDelegate.nativePreloadModule(moduleName, abilityName);
     }
 
+    /**
+     * Read the abc files of modules and of the shared modules they depend on in parallel on background threads.
+     * Call it before loadModule of these modules, which then take the prefetched files. preloadEtsModule
+     * prefetches its module itself.
+     *
+     * @param moduleNames The names of the modules to prefetch.
+     */
+    public static void prefetchEtsModules(String[] moduleNames) {
+        if (moduleNames == null || moduleNames.length == 0) {
+            ALog.e(LOG_TAG, "moduleNames is null");
+            return;
+        }
+        StageApplicationDelegate.nativePrefetchModules(moduleNames);
+    }
+
     /**
      * Should load UI.
      *
@@ -1397,4 +1397,11 @@ public class StageApplicationDelegate {
      * @param entryFile the path of load module.
      */
     protected static native void nativeLoadModule(String moduleName, String entryFile);
+
+    /**
+     * Native calls the prefetch of module abc files.
+     *
+     * @param moduleNames the names of the modules to prefetch.
+     */
+    protected static native void nativePrefetchModules(String[] moduleNames);
 }
@@ -15,11 +15,13 @@
 
 #include "adapter/android/stage/uicontent/ace_container_sg.h"
 
+#include <algorithm>
 #include <numeric>
 
 #include "adapter/android/entrance/java/jni/ace_application_info_impl.h"
 #include "adapter/android/entrance/java/jni/ace_platform_plugin_jni.h"
 #include "adapter/android/entrance/java/jni/apk_asset_provider.h"
+#include "adapter/android/entrance/java/jni/input_latency_recorder.h"
 #include "adapter/android/entrance/java/jni/jni_registry.h"
 #include "adapter/android/stage/uicontent/ace_view_sg.h"
 #include "application_context.h"
@@ -28,8 +30,10 @@
 #include "base/log/event_report.h"
 #include "base/log/log.h"
 #include "base/subwindow/subwindow_manager.h"
+#include "base/thread/thread_priority.h"
 #include "base/utils/layout_break_point.h"
 #include "base/utils/system_properties.h"
+#include "base/utils/time_util.h"
 #include "base/utils/utils.h"
 #include "core/common/ace_engine.h"
 #include "core/common/ace_view.h"
@@ -118,6 +122,34 @@ void ParseLocaleTag(const std::string& localeTag, std::string& language, std::st
         script = elems[INDEX_SCRIPT].substr(elems[INDEX_SCRIPT].find("#") + 1);
     }
 }
+
+bool IsTypedKey(KeyCode code)
+{
+    return (code >= KeyCode::KEY_0 && code <= KeyCode::KEY_9) || (code >= KeyCode::KEY_A && code <= KeyCode::KEY_Z) ||
+           (code >= KeyCode::KEY_NUMPAD_0 && code <= KeyCode::KEY_NUMPAD_9) || code == KeyCode::KEY_COMMA ||
+           code == KeyCode::KEY_PERIOD || code == KeyCode::KEY_SPACE || code == KeyCode::KEY_GRAVE ||
+           code == KeyCode::KEY_MINUS || code == KeyCode::KEY_EQUALS || code == KeyCode::KEY_LEFT_BRACKET ||
+           code == KeyCode::KEY_RIGHT_BRACKET || code == KeyCode::KEY_BACKSLASH || code == KeyCode::KEY_SEMICOLON ||
+           code == KeyCode::KEY_APOSTROPHE || code == KeyCode::KEY_SLASH || code == KeyCode::KEY_DEL ||
+           code == KeyCode::KEY_FORWARD_DEL;
+}
+
+bool IsShortcutModifier(KeyCode code)
+{
+    return code == KeyCode::KEY_CTRL_LEFT || code == KeyCode::KEY_CTRL_RIGHT || code == KeyCode::KEY_ALT_LEFT ||
+           code == KeyCode::KEY_ALT_RIGHT || code == KeyCode::KEY_META_LEFT || code == KeyCode::KEY_META_RIGHT;
+}
+
+// Only character and delete keys without Ctrl, Alt or Meta are posted to the UI thread and reported as consumed,
+// Android does nothing with them when the UI leaves them unhandled. Every other key (back, menu, dpad, tab, enter,
+// shortcuts, system keys) waits for the result so WindowViewCommon can hand unhandled ones to the activity.
+bool NeedsSyncKeyResult(const KeyEvent& event)
+{
+    if (!IsTypedKey(event.code)) {
+        return true;
+    }
+    return std::any_of(event.pressedCodes.begin(), event.pressedCodes.end(), IsShortcutModifier);
+}
 } // namespace
 
 AceContainerSG::AceContainerSG(int32_t instanceId, FrontendType type,
@@ -327,10 +359,15 @@ void AceContainerSG::InitializeCallback()
         auto bombId = GetMilliseconds();
         AceEngine::Get().BuriedBomb(instanceId, bombId);
         AceEngine::Get().DefusingBomb(instanceId);
+        int64_t postTime = InputLatencyRecorder::GetInstance().IsEnabled() ? GetSysTimestamp() : 0;
         context->GetTaskExecutor()->PostTask(
-            [weak, event, node]() {
+            [weak, event, node, postTime]() {
                 auto context = weak.Upgrade();
                 CHECK_NULL_VOID(context);
+                if (postTime != 0) {
+                    InputLatencyRecorder::GetInstance().RecordStage(InputStage::UI_QUEUE, GetSysTimestamp() - postTime);
+                }
+                InputStageScope stageScope(InputStage::UI_HANDLE);
                 if (event.type == TouchType::HOVER_ENTER || event.type == TouchType::HOVER_MOVE ||
                     event.type == TouchType::HOVER_EXIT || event.type == TouchType::HOVER_CANCEL) {
                     context->OnAccessibilityHoverEvent(event, node);
@@ -352,6 +389,17 @@ void AceContainerSG::InitializeCallback()
         auto bombId = GetMilliseconds();
         AceEngine::Get().BuriedBomb(instanceId, bombId);
         AceEngine::Get().DefusingBomb(instanceId);
+        if (!NeedsSyncKeyResult(event)) {
+            // Tasks run in order on the UI thread, so typed keys keep their order relative to synchronous ones.
+            context->GetTaskExecutor()->PostTask(
+                [weak, event]() {
+                    auto context = weak.Upgrade();
+                    CHECK_NULL_VOID(context);
+                    context->OnNonPointerEvent(event);
+                },
+                TaskExecutor::TaskType::UI, "ArkUI-XAceContainerSGKeyEventCallback");
+            return true;
+        }
         context->GetTaskExecutor()->PostSyncTask([context, event, &result]() { result = context->OnNonPointerEvent(event); },
             TaskExecutor::TaskType::UI, "ArkUI-XAceContainerSGKeyEventCallback");
         return result;
@@ -673,6 +721,9 @@ void AceContainerSG::AttachView(
         auto* aceView = static_cast<Platform::AceViewSG*>(aceView_);
         CHECK_NULL_VOID(aceView);
         taskExecutorImpl->InitOtherThreads(aceView->GetThreadModel());
+        // The UI thread is not created by TaskExecutorImpl, so it never runs through SetThreadPriority itself.
+        taskExecutorImpl->PostTask([]() { ThreadPriority::SetThreadPriority(TaskExecutor::TaskType::UI); },
+            TaskExecutor::TaskType::UI, "ArkUI-XAceContainerSGApplyUIThreadPolicy");
     }
 #endif
     ContainerScope scope(instanceId);
@@ -1369,56 +1420,77 @@ void AceContainerSG::InitWindowCallback()
 
 void AceContainerSG::SetCurPointerEvent(const std::shared_ptr<MMI::PointerEvent>& currentEvent)
 {
-    std::lock_guard<std::mutex> lock(pointerEventMutex_);
-    currentPointerEvent_ = currentEvent;
+    CHECK_NULL_VOID(currentEvent);
+    std::atomic_store(&currentPointerEvent_, currentEvent);
     MMI::PointerEvent::PointerItem pointerItem;
     currentEvent->GetPointerItem(currentEvent->GetPointerId(), pointerItem);
     int32_t originId = pointerItem.GetOriginPointerId();
-    currentEvents_[originId] = currentEvent;
-    auto callbacksIter = stopDragCallbackMap_.begin();
-    while (callbacksIter != stopDragCallbackMap_.end()) {
-        auto pointerId = callbacksIter->first;
-        MMI::PointerEvent::PointerItem pointerItem;
-        bool hasPointerItem = currentEvent->GetPointerItem(pointerId, pointerItem);
-        bool isPressed = hasPointerItem ? pointerItem.IsPressed() : false;
-        if (!hasPointerItem || !isPressed) {
-            for (const auto& callback : callbacksIter->second) {
-                if (callback) {
-                    callback();
-                }
+    if (PointerActionState::IsValidPointerId(originId)) {
+        std::atomic_store(&currentEvents_[originId], currentEvent);
+    }
+    // Pairs with the fence in GetCurPointerEventInfo: either this sees the flag or the registering side sees this
+    // event, so a release can not slip between a drag start and its callback registration.
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (hasStopDragCallbacks_.load(std::memory_order_relaxed)) {
+        HandleStopDragCallbacks(currentEvent);
+    }
+}
+
+void AceContainerSG::HandleStopDragCallbacks(const std::shared_ptr<MMI::PointerEvent>& currentEvent)
+{
+    std::list<StopDragCallback> callbacks;
+    {
+        std::lock_guard<std::mutex> lock(stopDragMutex_);
+        auto callbacksIter = stopDragCallbackMap_.begin();
+        while (callbacksIter != stopDragCallbackMap_.end()) {
+            MMI::PointerEvent::PointerItem pointerItem;
+            bool hasPointerItem = currentEvent->GetPointerItem(callbacksIter->first, pointerItem);
+            if (!hasPointerItem || !pointerItem.IsPressed()) {
+                callbacks.splice(callbacks.end(), callbacksIter->second);
+                callbacksIter = stopDragCallbackMap_.erase(callbacksIter);
+            } else {
+                ++callbacksIter;
             }
-            callbacksIter = stopDragCallbackMap_.erase(callbacksIter);
-        } else {
-            ++callbacksIter;
+        }
+        hasStopDragCallbacks_.store(!stopDragCallbackMap_.empty());
+    }
+    // Called outside the lock, a callback may start another drag.
+    for (const auto& callback : callbacks) {
+        if (callback) {
+            callback();
         }
     }
 }
 
 bool AceContainerSG::GetCurPointerEventInfo(DragPointerEvent& dragPointerEvent, StopDragCallback&& stopDragCallback)
 {
-    std::lock_guard<std::mutex> lock(pointerEventMutex_);
-    CHECK_NULL_RETURN(currentPointerEvent_, false);
+    auto currentPointerEvent = std::atomic_load(&currentPointerEvent_);
+    CHECK_NULL_RETURN(currentPointerEvent, false);
     MMI::PointerEvent::PointerItem pointerItem;
-    if (!currentPointerEvent_->GetPointerItem(dragPointerEvent.pointerId, pointerItem) || !pointerItem.IsPressed()) {
+    if (!currentPointerEvent->GetPointerItem(dragPointerEvent.pointerId, pointerItem) || !pointerItem.IsPressed()) {
         return false;
     }
-    dragPointerEvent.sourceType = currentPointerEvent_->GetSourceType();
+    dragPointerEvent.sourceType = currentPointerEvent->GetSourceType();
     dragPointerEvent.displayX = pointerItem.GetDisplayX();
     dragPointerEvent.displayY = pointerItem.GetDisplayY();
     dragPointerEvent.sourceTool = static_cast<SourceTool>(pointerItem.GetToolType());
     RegisterStopDragCallback(dragPointerEvent.pointerId, std::move(stopDragCallback));
+    // The pointer may have been released after the snapshot was taken but before the callback was registered.
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    auto latestPointerEvent = std::atomic_load(&currentPointerEvent_);
+    if (latestPointerEvent != currentPointerEvent) {
+        HandleStopDragCallbacks(latestPointerEvent);
+    }
     return true;
 }
 
 bool AceContainerSG::GetLastMovingPointerPosition(DragPointerEvent& dragPointerEvent)
 {
-    std::lock_guard<std::mutex> lock(pointerEventMutex_);
-    auto iter = currentEvents_.find(dragPointerEvent.originId);
-    if (iter == currentEvents_.end()) {
+    if (!PointerActionState::IsValidPointerId(dragPointerEvent.originId)) {
         return false;
     }
     MMI::PointerEvent::PointerItem pointerItem;
-    auto currentPointerEvent = iter->second;
+    auto currentPointerEvent = std::atomic_load(&currentEvents_[dragPointerEvent.originId]);
     CHECK_NULL_RETURN(currentPointerEvent, false);
     if (!currentPointerEvent->GetPointerItem(currentPointerEvent->GetPointerId(), pointerItem) ||
         !pointerItem.IsPressed()) {
@@ -1509,6 +1581,8 @@ void AceContainerSG::UnsubscribeHighContrastChange()
 
 void AceContainerSG::RegisterStopDragCallback(int32_t pointerId, StopDragCallback&& stopDragCallback)
 {
+    std::lock_guard<std::mutex> lock(stopDragMutex_);
+    hasStopDragCallbacks_.store(true);
     auto iter = stopDragCallbackMap_.find(pointerId);
     if (iter != stopDragCallbackMap_.end()) {
         iter->second.emplace_back(std::move(stopDragCallback));
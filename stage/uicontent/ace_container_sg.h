@@ -16,6 +16,8 @@
 #ifndef FOUNDATION_ACE_ADAPTER_ANDROID_STAGE_ACE_CONTAINER_SG_H
 #define FOUNDATION_ACE_ADAPTER_ANDROID_STAGE_ACE_CONTAINER_SG_H
 
+#include <array>
+#include <atomic>
 #include <chrono>
 #include <memory>
 
@@ -23,6 +25,7 @@
 #include "adapter/android/entrance/java/jni/virtual_rs_window.h"
 
 #include "adapter/android/entrance/java/jni/ace_resource_register.h"
+#include "adapter/android/entrance/java/jni/pointer_action_state.h"
 #include "adapter/android/stage/uicontent/platform_event_callback.h"
 #include "base/resource/asset_manager.h"
 #include "base/thread/task_executor.h"
@@ -398,6 +401,7 @@ private:
     void SetUIWindowInner(sptr<OHOS::Rosen::Window> uiWindow);
     sptr<OHOS::Rosen::Window> GetUIWindowInner() const;
     void RegisterStopDragCallback(int32_t pointerId, StopDragCallback&& stopDragCallback);
+    void HandleStopDragCallbacks(const std::shared_ptr<MMI::PointerEvent>& currentEvent);
     void SetFontAndScale(Platform::ParsedConfig& parsedConfig, ConfigurationChange& configurationChange);
     void SetLanguage(Platform::ParsedConfig& parsedConfig, ConfigurationChange& configurationChange,
         ResourceConfiguration& resConfig);
@@ -448,10 +452,14 @@ private:
     std::string windowName_;
     bool isSubContainer_ = false;
 
-    std::mutex pointerEventMutex_;
+    // Written on the platform thread for every pointer event and read by drag on the UI thread, both are published
+    // with atomic shared_ptr operations. currentEvents_ is indexed by the origin (Android) pointer id.
     std::shared_ptr<MMI::PointerEvent> currentPointerEvent_;
+    std::array<std::shared_ptr<MMI::PointerEvent>, PointerActionState::MAX_POINTER_COUNT> currentEvents_;
+    // Only pending while a drag is starting, pointer events skip the mutex when the flag is clear.
+    std::mutex stopDragMutex_;
+    std::atomic<bool> hasStopDragCallbacks_ { false };
     std::unordered_map<int32_t, std::list<StopDragCallback>> stopDragCallbackMap_;
-    std::map<int32_t, std::shared_ptr<MMI::PointerEvent>> currentEvents_;
     std::unordered_set<std::string> resAdapterRecord_;
     ACE_DISALLOW_COPY_AND_MOVE(AceContainerSG);
 };
@@ -15,18 +15,30 @@
 
 #include "adapter/android/stage/uicontent/ace_view_sg.h"
 
+#include <algorithm>
+#include <cctype>
+
+#include "adapter/android/capability/java/jni/texture/image_texture_jni.h"
 #include "adapter/android/entrance/java/jni/ace_platform_plugin_jni.h"
 #include "adapter/android/entrance/java/jni/ace_resource_register.h"
+#include "adapter/android/entrance/java/jni/input_latency_recorder.h"
+#include "adapter/android/entrance/java/jni/input_replay.h"
 #include "adapter/android/entrance/java/jni/jni_environment.h"
+#include "adapter/android/osal/frame_phase_recorder.h"
+#include "adapter/android/osal/resource_adapter_impl_v2.h"
+#include "adapter/android/osal/startup_profiler.h"
+#include "adapter/android/osal/thread_sched_policy.h"
 #include "adapter/android/stage/uicontent/ace_container_sg.h"
 #include "base/log/dump_log.h"
 #include "base/log/event_report.h"
 #include "base/log/log.h"
 #include "base/utils/macros.h"
+#include "base/utils/string_utils.h"
 #include "base/utils/system_properties.h"
 #include "base/utils/utils.h"
 #include "core/common/ace_engine.h"
 #include "core/common/container_scope.h"
+#include "core/common/resource/resource_manager.h"
 #include "core/common/thread_checker.h"
 #include "core/components/theme/app_theme.h"
 #include "core/components/theme/theme_manager.h"
@@ -35,6 +47,104 @@
 #include "core/image/image_cache.h"
 
 namespace OHOS::Ace::Platform {
+namespace {
+struct ResourceTypeName {
+    const char* name;
+    ResourceRequest::Type type;
+};
+
+constexpr ResourceTypeName RESOURCE_TYPE_NAMES[] = {
+    { "color", ResourceRequest::Type::COLOR },
+    { "dimension", ResourceRequest::Type::DIMENSION },
+    { "string", ResourceRequest::Type::STRING },
+    { "double", ResourceRequest::Type::DOUBLE },
+    { "int", ResourceRequest::Type::INT },
+    { "boolean", ResourceRequest::Type::BOOLEAN },
+    { "media", ResourceRequest::Type::MEDIA_PATH },
+    { "symbol", ResourceRequest::Type::SYMBOL },
+};
+
+bool IsAllDigits(const std::string& value)
+{
+    return !value.empty() &&
+           std::all_of(value.begin(), value.end(), [](char c) { return std::isdigit(static_cast<unsigned char>(c)); });
+}
+
+// Parses <type>:<name or id>, an all digit value is looked up by id.
+bool ParseResourceRequest(const std::string& entry, ResourceRequest& request)
+{
+    auto pos = entry.find(':');
+    if (pos == std::string::npos || pos + 1 == entry.size()) {
+        return false;
+    }
+    auto typeName = entry.substr(0, pos);
+    auto value = entry.substr(pos + 1);
+    auto iter = std::find_if(std::begin(RESOURCE_TYPE_NAMES), std::end(RESOURCE_TYPE_NAMES),
+        [&typeName](const ResourceTypeName& item) { return typeName == item.name; });
+    if (iter == std::end(RESOURCE_TYPE_NAMES)) {
+        return false;
+    }
+    request.type = iter->type;
+    if (IsAllDigits(value)) {
+        request.resId = StringUtils::StringToUint(value);
+    } else {
+        request.resName = value;
+    }
+    return true;
+}
+
+std::string ResourceResultToString(const ResourceResult& result)
+{
+    if (auto color = std::get_if<Color>(&result.value)) {
+        return color->ColorToString();
+    }
+    if (auto dimension = std::get_if<Dimension>(&result.value)) {
+        return dimension->ToString();
+    }
+    if (auto text = std::get_if<std::string>(&result.value)) {
+        return *text;
+    }
+    if (auto number = std::get_if<double>(&result.value)) {
+        return std::to_string(*number);
+    }
+    if (auto integer = std::get_if<int32_t>(&result.value)) {
+        return std::to_string(*integer);
+    }
+    if (auto flag = std::get_if<bool>(&result.value)) {
+        return *flag ? "true" : "false";
+    }
+    if (auto symbol = std::get_if<uint32_t>(&result.value)) {
+        return std::to_string(*symbol);
+    }
+    return "not found";
+}
+
+// Reads rawfile:<name> or mediadata:<name or id> through the shared views, empty for other entries.
+std::string DumpResourceView(const RefPtr<ResourceAdapterImplV2>& resourceAdapter, const std::string& entry)
+{
+    auto pos = entry.find(':');
+    if (pos == std::string::npos || pos + 1 == entry.size()) {
+        return "";
+    }
+    auto typeName = entry.substr(0, pos);
+    auto value = entry.substr(pos + 1);
+    std::shared_ptr<const ResourceDataView> view;
+    if (typeName == "rawfile") {
+        view = resourceAdapter->GetRawFileView(value);
+    } else if (typeName == "mediadata") {
+        view = IsAllDigits(value) ? resourceAdapter->GetMediaView(StringUtils::StringToUint(value))
+                                  : resourceAdapter->GetMediaView(value);
+    } else {
+        return "";
+    }
+    if (!view) {
+        return entry + ": not found\n";
+    }
+    return entry + ": " + std::to_string(view->GetSize()) + " bytes, " + (view->IsMapped() ? "mapped" : "copied") +
+           "\n";
+}
+} // namespace
+
 AceViewSG* AceViewSG::CreateView(int32_t instanceId)
 {
     auto* aceView = new AceViewSG(instanceId);
@@ -131,6 +241,35 @@ void AceViewSG::RegisterSystemBarHeightChangeCallback(SystemBarHeightChangeCallb
 
 bool AceViewSG::Dump(const std::vector<std::string>& params)
 {
+    if (!params.empty() && params[0] == "-inputlatency") {
+        return DumpInputLatency(params);
+    }
+    if (!params.empty() && params[0] == "-framephase") {
+        return DumpFramePhases(params);
+    }
+    if (!params.empty() && params[0] == "-resource") {
+        return DumpResources(params);
+    }
+    if (!params.empty() && params[0] == "-imagetexture") {
+        auto desc = ImageTextureJni::DumpAllStats();
+        if (DumpLog::GetInstance().GetDumpFile()) {
+            DumpLog::GetInstance().AddDesc(desc);
+            DumpLog::GetInstance().Print(0, "ImageTexture:", 0);
+        } else {
+            LOGI("%{public}s", desc.c_str());
+        }
+        return true;
+    }
+    if (!params.empty() && params[0] == "-startup") {
+        auto report = StartupProfiler::GetInstance().ToJson();
+        if (DumpLog::GetInstance().GetDumpFile()) {
+            DumpLog::GetInstance().AddDesc(report);
+            DumpLog::GetInstance().Print(0, "Startup:", 0);
+        } else {
+            LOGI("%{public}s", report.c_str());
+        }
+        return true;
+    }
     if (params.empty() || params[0] != "-drawcmd") {
         LOGE("Unsupported parameters.");
         return false;
@@ -143,6 +282,118 @@ bool AceViewSG::Dump(const std::vector<std::string>& params)
     return false;
 }
 
+// -inputlatency [on | off | reset | capture <path> | stopcapture | replay <path>], prints the report without option.
+bool AceViewSG::DumpInputLatency(const std::vector<std::string>& params)
+{
+    auto& recorder = InputLatencyRecorder::GetInstance();
+    std::string option = params.size() > 1 ? params[1] : "";
+    std::string path = params.size() > 2 ? params[2] : "";
+    std::string desc;
+    if (option == "on" || option == "off") {
+        recorder.SetEnabled(option == "on");
+        desc = "input latency recording " + option;
+    } else if (option == "reset") {
+        recorder.Reset();
+        desc = "input latency reset";
+    } else if (option == "capture" && !path.empty()) {
+        desc = recorder.StartCapture(path) ? "capturing input to " + path : "failed to capture input to " + path;
+    } else if (option == "stopcapture") {
+        recorder.StopCapture();
+        desc = "input capture stopped";
+    } else if (option == "replay" && !path.empty()) {
+        // Recorded touches carry stale timestamps, they are converted and dropped instead of reaching the window.
+        auto replayed = ReplayInputCapture(path, [](const TouchEvent& /* event */) {});
+        desc = "replayed " + std::to_string(replayed.packets) + " packets, " + std::to_string(replayed.events) +
+               " touch events\n" + recorder.DumpReport();
+    } else {
+        desc = recorder.DumpReport();
+    }
+    if (DumpLog::GetInstance().GetDumpFile()) {
+        DumpLog::GetInstance().AddDesc(desc);
+        DumpLog::GetInstance().Print(0, "InputLatency:", 0);
+    } else {
+        LOGI("%{public}s", desc.c_str());
+    }
+    return true;
+}
+
+// -framephase [on | off | reset], prints the phase percentiles in microseconds without option.
+bool AceViewSG::DumpFramePhases(const std::vector<std::string>& params)
+{
+    constexpr int64_t NANOS_PER_MICRO = 1000;
+    auto& recorder = FramePhaseRecorder::GetInstance();
+    std::string option = params.size() > 1 ? params[1] : "";
+    std::string desc;
+    if (option == "on" || option == "off") {
+        recorder.SetEnabled(option == "on");
+        desc = "frame phase recording " + option;
+    } else if (option == "reset") {
+        recorder.Reset();
+        desc = "frame phase reset";
+    } else {
+        auto percentiles = recorder.GetPercentiles();
+        desc = std::string("enabled: ") + (recorder.IsEnabled() ? "true" : "false") +
+               ", frames: " + std::to_string(percentiles.sampleCount) + "\n";
+        for (size_t phase = 0; phase < FRAME_PHASE_COUNT; ++phase) {
+            desc += std::string(FramePhaseRecorder::GetPhaseName(static_cast<FramePhase>(phase))) +
+                    " p50/p90/p99: " + std::to_string(percentiles.p50[phase] / NANOS_PER_MICRO) + "/" +
+                    std::to_string(percentiles.p90[phase] / NANOS_PER_MICRO) + "/" +
+                    std::to_string(percentiles.p99[phase] / NANOS_PER_MICRO) + "\n";
+        }
+        desc += "total p50/p90/p99: " + std::to_string(percentiles.totalP50 / NANOS_PER_MICRO) + "/" +
+                std::to_string(percentiles.totalP90 / NANOS_PER_MICRO) + "/" +
+                std::to_string(percentiles.totalP99 / NANOS_PER_MICRO);
+    }
+    if (DumpLog::GetInstance().GetDumpFile()) {
+        DumpLog::GetInstance().AddDesc(desc);
+        DumpLog::GetInstance().Print(0, "FramePhase:", 0);
+    } else {
+        LOGI("%{public}s", desc.c_str());
+    }
+    return true;
+}
+
+// -resource <type>:<name or id>..., resolves the entries with one GetResources call. Types are color, dimension,
+// string, double, int, boolean, media (the path) and symbol. rawfile and mediadata entries are read through the
+// shared views and print their size and whether the bytes are mapped.
+bool AceViewSG::DumpResources(const std::vector<std::string>& params)
+{
+    auto resourceAdapter = AceType::DynamicCast<ResourceAdapterImplV2>(
+        ResourceManager::GetInstance().GetResourceAdapter("", "", instanceId_));
+    std::string desc;
+    if (!resourceAdapter) {
+        desc = "no resource adapter for instance " + std::to_string(instanceId_);
+    } else {
+        std::vector<std::string> entries;
+        std::vector<ResourceRequest> requests;
+        for (size_t index = 1; index < params.size(); ++index) {
+            auto viewDesc = DumpResourceView(resourceAdapter, params[index]);
+            if (!viewDesc.empty()) {
+                desc += viewDesc;
+                continue;
+            }
+            ResourceRequest request;
+            if (!ParseResourceRequest(params[index], request)) {
+                desc += params[index] + ": unsupported entry\n";
+                continue;
+            }
+            entries.emplace_back(params[index]);
+            requests.emplace_back(std::move(request));
+        }
+        auto results = resourceAdapter->GetResources(requests);
+        for (size_t index = 0; index < results.size(); ++index) {
+            desc += entries[index] + ": " + ResourceResultToString(results[index]) + "\n";
+        }
+    }
+    if (DumpLog::GetInstance().GetDumpFile()) {
+        DumpLog::GetInstance().AddDesc(desc);
+        DumpLog::GetInstance().Print(0, "Resource:", 0);
+    } else {
+        LOGI("%{public}s", desc.c_str());
+    }
+    return true;
+}
+
 const void* AceViewSG::GetNativeWindowById(uint64_t textureId)
 {
     return AcePlatformPluginJni::GetNativeWindow(instanceId_, static_cast<int64_t>(textureId));
@@ -181,6 +432,7 @@ bool AceViewSG::DispatchBasicEvent(const std::vector<TouchEvent>& touchEvents)
 
 bool AceViewSG::DispatchTouchEvent(const std::shared_ptr<OHOS::MMI::PointerEvent>& pointerEvent)
 {
+    InputStageScope stageScope(InputStage::DISPATCH);
     auto instanceId = GetInstanceId();
     auto container = Platform::AceContainerSG::GetContainer(instanceId);
     container->SetCurPointerEvent(pointerEvent);
@@ -195,6 +447,9 @@ void AceViewSG::ProcessTouchEvent(const std::shared_ptr<OHOS::MMI::PointerEvent>
 {
     CHECK_NULL_VOID(pointerEvent);
     TouchEvent touchPoint = ConvertTouchEvent(pointerEvent);
+    if (touchPoint.type == TouchType::DOWN) {
+        ThreadSchedPolicy::GetInstance().Boost(BoostScene::TOUCH_DOWN);
+    }
     DispatchEventToPerf(touchPoint);
     if (touchPoint.type != TouchType::UNKNOWN) {
         if (touchEventCallback_) {
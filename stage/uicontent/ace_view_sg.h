@@ -133,6 +133,9 @@ public:
 
 private:
     bool IsLastPage() const;
+    bool DumpInputLatency(const std::vector<std::string>& params);
+    bool DumpFramePhases(const std::vector<std::string>& params);
+    bool DumpResources(const std::vector<std::string>& params);
     void NotifySurfacePositionChanged(int32_t posX, int32_t posY);
 
     int32_t instanceId_ = -1;
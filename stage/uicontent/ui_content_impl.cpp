@@ -33,6 +33,7 @@
 #include "adapter/android/osal/js_accessibility_manager.h"
 #include "adapter/android/osal/navigation_route.h"
 #include "adapter/android/osal/page_url_checker_android.h"
+#include "adapter/android/osal/startup_profiler.h"
 #include "adapter/android/stage/uicontent/ace_container_sg.h"
 #include "adapter/android/stage/uicontent/ace_view_sg.h"
 #include "adapter/android/stage/uicontent/platform_event_callback.h"
@@ -215,6 +216,7 @@ void UIContentImpl::InitializeInner(
     }
     LOGI("InitializeInner startUrl = %{public}s", startUrl_.c_str());
 
+    StartupPhaseScope startupPhase(StartupPhase::RUN_PAGE);
     Platform::AceContainerSG::RunPage(instanceId_,
         Platform::AceContainerSG::GetContainer(instanceId_)->GeneratePageId(), startUrl_, "", isNamedRouter);
     LOGI("InitializeInner RunPage UIContentImpl done.");
@@ -284,6 +286,7 @@ void UIContentImpl::CommonInitialize(OHOS::Rosen::Window* window, const std::str
         LOGI("hapPath:%{public}s", hapPath.c_str());
         // first use hap provider
         if (assetManagerImpl && !hapPath.empty()) {
+            StartupPhaseScope startupPhase(StartupPhase::ASSET_PROVIDER_INIT);
             auto assetProvider = AbilityRuntime::Platform::StageAssetProvider::GetInstance();
             CHECK_NULL_VOID(assetProvider);
             auto dynamicLoadFlag = true;
@@ -338,6 +341,7 @@ void UIContentImpl::CommonInitialize(OHOS::Rosen::Window* window, const std::str
     }
 
     AceTraceBegin("CreateAndInitConatienr");
+    StartupProfiler::GetInstance().BeginPhase(StartupPhase::CONTAINER_INIT);
     auto container = AceType::MakeRefPtr<Platform::AceContainerSG>(instanceId_, FrontendType::DECLARATIVE_JS, context_,
         info,
         std::make_unique<ContentEventCallback>(
@@ -442,16 +446,22 @@ void UIContentImpl::CommonInitialize(OHOS::Rosen::Window* window, const std::str
     std::vector<std::string> resourcePaths;
     std::string sysResPath { "" };
     abilityContext->GetResourcePaths(resourcePaths, sysResPath);
+    StartupProfiler::GetInstance().EndPhase(StartupPhase::CONTAINER_INIT);
+    // The resource manager and the theme are created here.
+    StartupProfiler::GetInstance().BeginPhase(StartupPhase::RESOURCE_INIT);
     container->SetResPaths(resourcePaths, sysResPath, container->GetColorMode());
+    StartupProfiler::GetInstance().EndPhase(StartupPhase::RESOURCE_INIT);
     AceTraceEnd();
 
     AceTraceBegin("CreateAndSetView");
+    StartupProfiler::GetInstance().BeginPhase(StartupPhase::VIEW_ATTACH);
     auto aceView = Platform::AceViewSG::CreateView(instanceId_);
     if (!window_) {
         Platform::AceViewSG::SurfaceCreated(aceView, window_);
     }
     // set view
     Platform::AceContainerSG::SetView(aceView, density, 0, 0, window_);
+    StartupProfiler::GetInstance().EndPhase(StartupPhase::VIEW_ATTACH);
     AceTraceEnd();
     if (window_) {
         occupiedAreaChangeListener_ = new OccupiedAreaChangeListener(instanceId_);
@@ -912,7 +922,19 @@ bool UIContentImpl::WaitEventIdle(uint32_t idleThresholdMs, uint32_t timeoutMs)
         CHECK_NULL_RETURN(g_uiEventMonitor, false);
         monitor = g_uiEventMonitor;
     }
-    return monitor->WaitEventIdle(idleThresholdMs, timeoutMs);
+    auto probe = [instanceId = instanceId_](std::function<void()>&& task) {
+        auto container = AceEngine::Get().GetContainer(instanceId);
+        CHECK_NULL_RETURN(container, false);
+        auto taskExecutor = container->GetTaskExecutor();
+        CHECK_NULL_RETURN(taskExecutor, false);
+        // Waiting on the UI thread for a task queued behind itself would always time out, the drain is skipped.
+        if (taskExecutor->WillRunOnCurrentThread(TaskExecutor::TaskType::UI)) {
+            return false;
+        }
+        taskExecutor->PostTask(std::move(task), TaskExecutor::TaskType::UI, "ArkUI-XUiEventMonitorIdleProbe");
+        return true;
+    };
+    return monitor->WaitEventIdle(idleThresholdMs, timeoutMs, probe);
 }
 
 RefPtr<OHOS::Ace::DisplayInfo> UIContentImpl::GetDisplayInfo()
@@ -15,13 +15,24 @@
 
 #include "adapter/android/stage/uicontent/ui_event_monitor.h"
 
+#include <algorithm>
 #include <chrono>
-#include <thread>
 
+#include "adapter/android/osal/frame_phase_recorder.h"
 #include "adapter/android/osal/js_accessibility_manager.h"
 #include "base/log/log.h"
+#include "base/utils/time_util.h"
 
 namespace OHOS::Ace::Platform {
+namespace {
+constexpr int64_t NANOS_PER_MILLI = 1000000;
+
+std::chrono::steady_clock::time_point ToTimePoint(uint64_t millis)
+{
+    return std::chrono::steady_clock::time_point(std::chrono::milliseconds(millis));
+}
+} // namespace
+
 UiEventMonitor::UiEventMonitor()
 {
     ResetEventTimer();
@@ -66,32 +77,93 @@ void UiEventMonitor::OnAccessibilityEvent(const OHOS::Accessibility::Accessibili
     for (auto watchedType : EVENT_MASK) {
         if (eventType == watchedType) {
             lastEventMillis_.store(GetCurrentMillisecond());
+            NotifyWaiters();
             break;
         }
     }
 }
 
-bool UiEventMonitor::WaitEventIdle(uint32_t idleThresholdMs, uint32_t timeoutMs)
+void UiEventMonitor::NotifyWaiters()
+{
+    if (waiterCount_.load() == 0) {
+        return;
+    }
+    // Taking the lock orders the notification after a waiter's last check, so the wakeup can not be lost.
+    std::lock_guard<std::mutex> lock(idleMutex_);
+    idleCondition_.notify_all();
+}
+
+uint64_t UiEventMonitor::GetLastActivityMillis(uint64_t currentMs)
+{
+    uint64_t lastActivityMs = lastEventMillis_.load();
+    if (activeScrollCount_.load() > 0) {
+        return currentMs;
+    }
+    int64_t lastFrameEnd = FramePhaseRecorder::GetInstance().GetLastFrameEnd();
+    if (lastFrameEnd > 0) {
+        int64_t frameAgeNs = std::max<int64_t>(GetSysTimestamp() - lastFrameEnd, 0);
+        auto frameAgeMs = static_cast<uint64_t>(frameAgeNs / NANOS_PER_MILLI);
+        if (frameAgeMs < currentMs) {
+            lastActivityMs = std::max(lastActivityMs, currentMs - frameAgeMs);
+        }
+    }
+    return lastActivityMs;
+}
+
+bool UiEventMonitor::WaitUiTasksDrained(
+    std::unique_lock<std::mutex>& lock, uint64_t deadlineMs, const UiTaskProbe& probe)
+{
+    auto drained = std::make_shared<std::atomic<bool>>(false);
+    std::weak_ptr<UiEventMonitor> weakThis = shared_from_this();
+    lock.unlock();
+    bool posted = probe([weakThis, drained]() {
+        drained->store(true);
+        if (auto monitor = weakThis.lock()) {
+            std::lock_guard<std::mutex> lock(monitor->idleMutex_);
+            monitor->idleCondition_.notify_all();
+        }
+    });
+    lock.lock();
+    if (!posted) {
+        return true;
+    }
+    return idleCondition_.wait_until(lock, ToTimePoint(deadlineMs), [&drained]() { return drained->load(); });
+}
+
+bool UiEventMonitor::WaitEventIdle(uint32_t idleThresholdMs, uint32_t timeoutMs, const UiTaskProbe& probe)
 {
     uint64_t startMs = GetCurrentMillisecond();
-    static constexpr auto sliceMs = 10;
-    uint64_t currentMs = GetCurrentMillisecond();
-    while (currentMs - startMs < timeoutMs) {
-        if (activeScrollCount_.load() > 0) {
-            lastEventMillis_.store(currentMs);
+    uint64_t deadlineMs = startMs + timeoutMs;
+    if (lastEventMillis_.load() == 0) {
+        lastEventMillis_.store(startMs);
+    }
+    std::unique_lock<std::mutex> lock(idleMutex_);
+    waiterCount_++;
+    bool idle = false;
+    uint64_t currentMs = startMs;
+    while (currentMs < deadlineMs) {
+        uint64_t quietUntilMs = GetLastActivityMillis(currentMs) + idleThresholdMs;
+        if (currentMs < quietUntilMs) {
+            // Scrolls keep the quiet period open, their end is an accessibility event that wakes this up.
+            idleCondition_.wait_until(lock, ToTimePoint(std::min(quietUntilMs, deadlineMs)));
+            currentMs = GetCurrentMillisecond();
+            continue;
         }
-        if (lastEventMillis_.load() <= 0) {
-            lastEventMillis_.store(currentMs);
+        uint64_t lastEventMs = lastEventMillis_.load();
+        int64_t lastFrameEnd = FramePhaseRecorder::GetInstance().GetLastFrameEnd();
+        if (probe && !WaitUiTasksDrained(lock, deadlineMs, probe)) {
+            break;
         }
-        if (currentMs - lastEventMillis_.load() >= idleThresholdMs) {
-            if (activeScrollCount_.load() == 0) {
-                return true;
-            }
+        // Tasks that were still queued may have produced new events or frames, the quiet period starts over then.
+        if (lastEventMillis_.load() == lastEventMs && activeScrollCount_.load() == 0 &&
+            FramePhaseRecorder::GetInstance().GetLastFrameEnd() == lastFrameEnd) {
+            idle = true;
+            break;
         }
-        std::this_thread::sleep_for(std::chrono::milliseconds(sliceMs));
         currentMs = GetCurrentMillisecond();
     }
-    return false;
+    waiterCount_--;
+    return idle;
 }
 
 uint64_t UiEventMonitor::GetLastEventMillis()
@@ -17,8 +17,11 @@
 #define ACE_ANDROID_UI_EVENT_MONITOR_H
 
 #include <atomic>
+#include <condition_variable>
 #include <cstdint>
+#include <functional>
 #include <memory>
+#include <mutex>
 #include <vector>
 
 #include "accessibility_event_info.h"
@@ -30,6 +33,10 @@ class AccessibilityEventInfo;
 namespace OHOS::Ace::Platform {
 class UiEventMonitor : public std::enable_shared_from_this<UiEventMonitor> {
 public:
+    // Posts the task behind everything already queued on the UI thread. Returns false when it could not be posted
+    // or the caller is the UI thread itself, the drain check is skipped then.
+    using UiTaskProbe = std::function<bool(std::function<void()>&&)>;
+
     static std::shared_ptr<UiEventMonitor> Create()
     {
         struct MakeSharedEnabler : public UiEventMonitor {
@@ -51,7 +58,9 @@ public:
 
     void OnAccessibilityEvent(const OHOS::Accessibility::AccessibilityEventInfo& eventInfo);
 
-    bool WaitEventIdle(uint32_t idleThresholdMs, uint32_t timeoutMs);
+    // Blocks until no accessibility event, scroll or frame happened for idleThresholdMs and, when a probe is given,
+    // the UI tasks queued at that point have run. Waiters sleep until the quiet period can end or an event arrives.
+    bool WaitEventIdle(uint32_t idleThresholdMs, uint32_t timeoutMs, const UiTaskProbe& probe = nullptr);
 
     uint64_t GetLastEventMillis();
 
@@ -63,9 +72,15 @@ private:
     UiEventMonitor();
 
     static uint64_t GetCurrentMillisecond();
+    uint64_t GetLastActivityMillis(uint64_t currentMs);
+    bool WaitUiTasksDrained(std::unique_lock<std::mutex>& lock, uint64_t deadlineMs, const UiTaskProbe& probe);
+    void NotifyWaiters();
 
     std::atomic<uint64_t> lastEventMillis_ { 0 };
     std::atomic<int32_t> activeScrollCount_ { 0 };
+    std::atomic<int32_t> waiterCount_ { 0 };
+    std::mutex idleMutex_;
+    std::condition_variable idleCondition_;
 };
 } // namespace OHOS::Ace::Platform
 
@@ -0,0 +1,152 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <condition_variable>
+#include <cstdio>
+#include <cstdlib>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+
+#include "adapter/android/entrance/java/jni/input_latency_recorder.h"
+#include "adapter/android/entrance/java/jni/input_replay.h"
+#include "base/utils/time_util.h"
+
+using namespace OHOS::Ace;
+using namespace OHOS::Ace::Platform;
+
+namespace {
+constexpr int32_t DEFAULT_ITERATIONS = 10;
+constexpr double NANOS_PER_SECOND = 1e9;
+
+// Stands in for the UI thread of a UIContent: touch events are queued like posted tasks and handled in order,
+// timing the queue wait and the handling as the real pipeline does.
+class StubTouchPipeline final {
+public:
+    StubTouchPipeline() : uiThread_([this]() { Run(); }) {}
+
+    ~StubTouchPipeline()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stopped_ = true;
+        }
+        condition_.notify_one();
+        uiThread_.join();
+    }
+
+    void Post(const TouchEvent& event)
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            tasks_.emplace_back(event, GetSysTimestamp());
+        }
+        condition_.notify_one();
+    }
+
+    void WaitIdle()
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        idleCondition_.wait(lock, [this]() { return tasks_.empty() && !handling_; });
+    }
+
+    size_t GetActivePointers() const
+    {
+        return activePointers_.size();
+    }
+
+private:
+    void Run()
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        while (true) {
+            condition_.wait(lock, [this]() { return stopped_ || !tasks_.empty(); });
+            if (tasks_.empty()) {
+                return;
+            }
+            auto [event, postTime] = tasks_.front();
+            tasks_.pop_front();
+            handling_ = true;
+            lock.unlock();
+            InputLatencyRecorder::GetInstance().RecordStage(InputStage::UI_QUEUE, GetSysTimestamp() - postTime);
+            {
+                InputStageScope stageScope(InputStage::UI_HANDLE);
+                Handle(event);
+            }
+            lock.lock();
+            handling_ = false;
+            if (tasks_.empty()) {
+                idleCondition_.notify_all();
+            }
+        }
+    }
+
+    void Handle(const TouchEvent& event)
+    {
+        if (event.type == TouchType::UP || event.type == TouchType::CANCEL) {
+            activePointers_.erase(event.id);
+        } else {
+            activePointers_[event.id] = event;
+        }
+    }
+
+    std::mutex mutex_;
+    std::condition_variable condition_;
+    std::condition_variable idleCondition_;
+    std::deque<std::pair<TouchEvent, int64_t>> tasks_;
+    bool handling_ = false;
+    bool stopped_ = false;
+    std::unordered_map<int32_t, TouchEvent> activePointers_;
+    std::thread uiThread_;
+};
+} // namespace
+
+// input_replay_benchmark <capture file> [iterations]
+// Replays a capture made with the -inputlatency capture dump option and prints the per-stage latency report.
+int main(int argc, char* argv[])
+{
+    if (argc < 2) {
+        printf("usage: %s <capture file> [iterations]\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+    int32_t iterations = argc > 2 ? atoi(argv[2]) : DEFAULT_ITERATIONS;
+    if (iterations <= 0) {
+        iterations = DEFAULT_ITERATIONS;
+    }
+    auto& recorder = InputLatencyRecorder::GetInstance();
+    recorder.SetEnabled(true);
+    recorder.Reset();
+
+    StubTouchPipeline pipeline;
+    InputReplayResult total;
+    int64_t begin = GetSysTimestamp();
+    for (int32_t iteration = 0; iteration < iterations; ++iteration) {
+        auto result = ReplayInputCapture(argv[1], [&pipeline](const TouchEvent& event) { pipeline.Post(event); });
+        if (result.packets == 0) {
+            printf("no packets replayed from %s\n", argv[1]);
+            return EXIT_FAILURE;
+        }
+        total.packets += result.packets;
+        total.events += result.events;
+    }
+    pipeline.WaitIdle();
+    double seconds = static_cast<double>(GetSysTimestamp() - begin) / NANOS_PER_SECOND;
+
+    printf("iterations: %d, packets: %d, touch events: %d, %.0f events/s, active pointers at end: %zu\n", iterations,
+        total.packets, total.events, seconds > 0 ? total.events / seconds : 0.0, pipeline.GetActivePointers());
+    printf("%s", recorder.DumpReport().c_str());
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,61 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "base/log/log_wrapper.h"
+
+#include <cstdio>
+#include <string>
+
+namespace OHOS::Ace {
+namespace {
+constexpr const char* PRIVACY_TAGS[] = { "{public}", "{private}" };
+} // namespace
+
+// Benchmarks link this instead of osal/log_wrapper.cpp, which forwards to the JNI log interface.
+LogLevel LogWrapper::level_ = LogLevel::DEBUG;
+
+char LogWrapper::GetSeparatorCharacter()
+{
+    return '/';
+}
+
+void LogWrapper::PrintLog(LogDomain domain, LogLevel level, AceLogTag tag, const char* fmt, va_list args)
+{
+    if (!LogWrapper::JudgeLevel(level) || fmt == nullptr) {
+        return;
+    }
+    std::string format(fmt);
+    for (const char* privacyTag : PRIVACY_TAGS) {
+        std::string::size_type pos = 0;
+        while ((pos = format.find(privacyTag, pos)) != std::string::npos) {
+            format.erase(pos, std::char_traits<char>::length(privacyTag));
+        }
+    }
+    vfprintf(stderr, format.c_str(), args);
+    fputc('\n', stderr);
+}
+
+#ifdef ACE_INSTANCE_LOG
+int32_t LogWrapper::GetId()
+{
+    return -1;
+}
+
+const std::string LogWrapper::GetIdWithReason()
+{
+    return "-1";
+}
+#endif
+} // namespace OHOS::Ace
@@ -0,0 +1,133 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <thread>
+
+#include "adapter/android/osal/startup_profiler.h"
+#include "base/utils/time_util.h"
+
+using namespace OHOS::Ace;
+
+namespace {
+constexpr int32_t DEFAULT_CALLS = 1000000;
+constexpr int32_t STUB_PHASE_US = 1000;
+constexpr int32_t STUB_FRAME_US = 2000;
+constexpr int32_t STUB_VSYNC_PERIOD_US = 4000;
+
+// Stubs for the platform hooks of a cold start. Each one opens its phase the way the JNI and UIContent entry points
+// do and holds it for a fixed time.
+void StubPlatformHook(StartupPhase phase)
+{
+    StartupPhaseScope scope(phase);
+    std::this_thread::sleep_for(std::chrono::microseconds(STUB_PHASE_US));
+}
+
+// Stands in for the vsync frame callback of the window. It starts ticking as soon as the view is attached, so the
+// frames of the empty window before RUN_PAGE must not count as the first frame.
+class StubVsync final {
+public:
+    StubVsync() : uiThread_([this]() { Run(); }) {}
+
+    ~StubVsync()
+    {
+        stopped_ = true;
+        uiThread_.join();
+    }
+
+private:
+    void Run()
+    {
+        auto& profiler = StartupProfiler::GetInstance();
+        while (!stopped_ && !profiler.IsFinished()) {
+            profiler.OnFrameBegin();
+            std::this_thread::sleep_for(std::chrono::microseconds(STUB_FRAME_US));
+            profiler.OnFrameEnd();
+            std::this_thread::sleep_for(std::chrono::microseconds(STUB_VSYNC_PERIOD_US - STUB_FRAME_US));
+        }
+    }
+
+    std::atomic<bool> stopped_ { false };
+    std::thread uiThread_;
+};
+
+// Runs the phases after JNI_OnLoad and waits for the stub vsync to deliver the first frame.
+void RunStubStartup()
+{
+    StubPlatformHook(StartupPhase::CLASS_REGISTRATION);
+    StubPlatformHook(StartupPhase::HAP_PATH);
+    StubPlatformHook(StartupPhase::MODULE_PRELOAD);
+    StubPlatformHook(StartupPhase::MODULE_LOAD);
+    StubPlatformHook(StartupPhase::ASSET_PROVIDER_INIT);
+    StubPlatformHook(StartupPhase::CONTAINER_INIT);
+    StubPlatformHook(StartupPhase::RESOURCE_INIT);
+    StubPlatformHook(StartupPhase::VIEW_ATTACH);
+    StubVsync vsync;
+    std::this_thread::sleep_for(std::chrono::microseconds(STUB_VSYNC_PERIOD_US * 2));
+    StubPlatformHook(StartupPhase::RUN_PAGE);
+    while (!StartupProfiler::GetInstance().IsFinished()) {
+        std::this_thread::sleep_for(std::chrono::microseconds(STUB_VSYNC_PERIOD_US));
+    }
+}
+
+// Average cost of one BeginPhase and EndPhase pair in ns, once a phase is recorded every later call is a no-op.
+double MeasurePhaseScope(StartupPhase phase, int32_t calls)
+{
+    int64_t begin = GetSysTimestamp();
+    for (int32_t call = 0; call < calls; ++call) {
+        StartupPhaseScope scope(phase);
+    }
+    return static_cast<double>(GetSysTimestamp() - begin) / calls;
+}
+} // namespace
+
+// startup_profiler_benchmark [calls]
+// Runs a cold start through stubbed platform hooks, checks the report and measures the cost of the phase hooks
+// while the startup runs and after the profiler finished.
+int main(int argc, char* argv[])
+{
+    int32_t calls = argc > 1 ? atoi(argv[1]) : DEFAULT_CALLS;
+    if (calls <= 0) {
+        calls = DEFAULT_CALLS;
+    }
+    auto& profiler = StartupProfiler::GetInstance();
+    StubPlatformHook(StartupPhase::JNI_ON_LOAD);
+    double duringStartupNs = MeasurePhaseScope(StartupPhase::JNI_ON_LOAD, calls);
+    RunStubStartup();
+    double afterStartupNs = MeasurePhaseScope(StartupPhase::JNI_ON_LOAD, calls);
+
+    auto report = profiler.GetReport();
+    if (!report.complete) {
+        printf("startup report is not complete\n");
+        return EXIT_FAILURE;
+    }
+    int64_t lastEnd = 0;
+    for (size_t index = 0; index < report.phases.size(); ++index) {
+        const auto& timing = report.phases[index];
+        auto phase = static_cast<StartupPhase>(index);
+        if (timing.begin < 0 || timing.end < timing.begin || timing.begin < lastEnd) {
+            printf("phase %s out of order: begin %lld, end %lld\n", StartupProfiler::GetPhaseName(phase),
+                static_cast<long long>(timing.begin), static_cast<long long>(timing.end));
+            return EXIT_FAILURE;
+        }
+        lastEnd = timing.end;
+    }
+    printf("phase hook: %.1f ns during startup, %.1f ns after it finished\n", duringStartupNs, afterStartupNs);
+    printf("%s\n", profiler.ToJson().c_str());
+    return EXIT_SUCCESS;
+}